@@ -0,0 +1,182 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef CONTROLS_CACHE_HPP
+#define CONTROLS_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "steering_functions/steering_functions.hpp"
+
+using namespace std;
+using namespace steer;
+
+/** \brief
+    Thread-safe least recently used cache of the controls of the shortest
+    paths. The controls are given relative to the start state, hence they
+    only depend on the pose of the goal relative to the start and on the
+    curvatures and driving directions of both states. By default, the
+    queries are keyed on the exact states. With a resolution > 0, the key is
+    the relative pose quantized to resolution and angular_resolution, so
+    that queries that differ by a rigid transformation (or by less than the
+    resolution) share an entry; the cached controls then reach the goal up
+    to the resolution. The entries are distributed over shards with a lock
+    and an LRU list each, so that concurrent queries rarely contend.
+    */
+class Controls_Cache
+{
+public:
+  /** \brief Hit and miss statistics */
+  struct Statistics
+  {
+    /** \brief Number of queries that were answered from the cache */
+    unsigned long long nb_hits;
+
+    /** \brief Number of queries that were not found in the cache */
+    unsigned long long nb_misses;
+
+    /** \brief Number of entries that were evicted */
+    unsigned long long nb_evictions;
+
+    /** \brief Number of entries */
+    size_t size;
+  };
+
+  /** \brief Constructor, the capacity is the max. number of entries and is distributed over nb_shards;
+      angular_resolution = 0 quantizes the orientation with resolution */
+  Controls_Cache(size_t capacity, size_t nb_shards = 16, double resolution = 0.0, double angular_resolution = 0.0);
+
+  /** \brief Copies the cached controls from state1 to state2 into controls, returns false on a miss */
+  bool lookup(const State &state1, const State &state2, vector<Control> *controls);
+
+  /** \brief Stores the controls from state1 to state2, the least recently used entry of the shard is evicted if the
+      shard is full */
+  void insert(const State &state1, const State &state2, const vector<Control> &controls);
+
+  /** \brief Removes all entries and resets the statistics */
+  void clear();
+
+  /** \brief Returns the hit and miss statistics */
+  Statistics get_statistics() const;
+
+private:
+  /** \brief Exact or quantized states of a query */
+  typedef array<uint64_t, 10> Key;
+
+  struct Key_Hash
+  {
+    size_t operator()(const Key &key) const;
+  };
+
+  /** \brief Entries with a lock, most recently used first */
+  struct Shard
+  {
+    mutex lock;
+    list<pair<Key, vector<Control>>> entries;
+    unordered_map<Key, list<pair<Key, vector<Control>>>::iterator, Key_Hash> index;
+  };
+
+  /** \brief Returns the key of the query from state1 to state2 */
+  Key get_key(const State &state1, const State &state2) const;
+
+  /** \brief Returns the shard of a key */
+  Shard &get_shard(const Key &key) const;
+
+  /** \brief Max. number of entries of a shard */
+  size_t shard_capacity_;
+
+  /** \brief Quantization of the relative position and orientation (0: exact states) */
+  double resolution_, angular_resolution_;
+
+  /** \brief Shards */
+  unique_ptr<Shard[]> shards_;
+  size_t nb_shards_;
+
+  /** \brief Statistics */
+  atomic<unsigned long long> nb_hits_, nb_misses_, nb_evictions_;
+};
+
+/** \brief
+    Caching wrapper around a state space: the shortest paths of repeated
+    queries are taken from a Controls_Cache instead of being recomputed.
+    The state space has to provide get_controls and integrate and has to be
+    reentrant to use the wrapper from several threads.
+    */
+template <typename State_Space>
+class Cached_State_Space
+{
+public:
+  /** \brief Constructor, the state space is referenced and has to outlive the wrapper */
+  Cached_State_Space(const State_Space &state_space, size_t capacity, size_t nb_shards = 16,
+                     double resolution = 0.0, double angular_resolution = 0.0)
+    : state_space_(state_space), cache_(capacity, nb_shards, resolution, angular_resolution)
+  {
+  }
+
+  /** \brief Returns the controls of the shortest path from state1 to state2 (cached) */
+  vector<Control> get_controls(const State &state1, const State &state2) const
+  {
+    vector<Control> controls;
+    if (!cache_.lookup(state1, state2, &controls))
+    {
+      controls = state_space_.get_controls(state1, state2);
+      cache_.insert(state1, state2, controls);
+    }
+    return controls;
+  }
+
+  /** \brief Returns the length of the shortest path from state1 to state2 as the sum of the lengths of the cached
+      controls */
+  double get_distance(const State &state1, const State &state2) const
+  {
+    double distance = 0.0;
+    for (const auto &control : get_controls(state1, state2))
+      distance += fabs(control.delta_s);
+    return distance;
+  }
+
+  /** \brief Returns the shortest path from state1 to state2 integrated from the cached controls */
+  vector<State> get_path(const State &state1, const State &state2) const
+  {
+    return state_space_.integrate(state1, get_controls(state1, state2));
+  }
+
+  /** \brief Returns the cache */
+  Controls_Cache &get_cache() const
+  {
+    return cache_;
+  }
+
+private:
+  /** \brief Wrapped state space */
+  const State_Space &state_space_;
+
+  /** \brief Cache of the controls, the queries are const */
+  mutable Controls_Cache cache_;
+};
+
+#endif
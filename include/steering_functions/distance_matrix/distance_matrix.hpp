@@ -0,0 +1,107 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef DISTANCE_MATRIX_HPP
+#define DISTANCE_MATRIX_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "steering_functions/steering_functions.hpp"
+
+using namespace std;
+using namespace steer;
+
+/** \brief
+    Computes matrices of shortest path lengths between two sets of states,
+    e.g. for the construction of roadmaps. The matrix is split into square
+    tiles that are distributed over a pool of worker threads, the result is
+    written row-major into a caller-provided buffer. The distances are
+    obtained from the get_distance function of a state space, which has to
+    be reentrant. The worker threads are started once by the constructor and
+    wait between the calls, concurrent calls on the same object are
+    serialized. If the distance function throws, the first exception is
+    rethrown once all threads finished (the matrix is then incomplete).
+    */
+class Distance_Matrix
+{
+public:
+  /** \brief Function that returns the shortest path length from state1 to state2 */
+  typedef function<double(const State &, const State &)> Distance_Function;
+
+  /** \brief Constructor, nb_threads = 0 selects the number of hardware threads */
+  Distance_Matrix(unsigned int nb_threads = 0, size_t tile_size = 64);
+
+  /** \brief Destructor, joins the worker threads */
+  ~Distance_Matrix();
+
+  /** \brief Number of worker threads */
+  unsigned int get_nb_threads() const;
+
+  /** \brief Stores the distance from states1[i] to states2[j] in distances[i * m + j] (n x m matrix) */
+  void compute(const Distance_Function &distance, const State *states1, size_t n, const State *states2, size_t m,
+               double *distances) const;
+
+  /** \brief Stores the distance between states[i] and states[j] in distances[i * n + j] (n x n matrix); only the
+      upper triangle is evaluated and mirrored, which requires distance(a, b) = distance(b, a) as for the
+      Reeds_Shepp_State_Space (the hc-/cc-reeds-shepp paths are not symmetric) */
+  void compute_symmetric(const Distance_Function &distance, const State *states, size_t n, double *distances) const;
+
+  /** \brief Convenience overloads that evaluate the get_distance function of state_space */
+  template <typename State_Space>
+  void compute(const State_Space &state_space, const State *states1, size_t n, const State *states2, size_t m,
+               double *distances) const
+  {
+    compute(get_distance_function(state_space), states1, n, states2, m, distances);
+  }
+
+  template <typename State_Space>
+  void compute_symmetric(const State_Space &state_space, const State *states, size_t n, double *distances) const
+  {
+    compute_symmetric(get_distance_function(state_space), states, n, distances);
+  }
+
+private:
+  /** \brief Wraps the get_distance function of state_space */
+  template <typename State_Space>
+  static Distance_Function get_distance_function(const State_Space &state_space)
+  {
+    return [&state_space](const State &state1, const State &state2) {
+      return state_space.get_distance(state1, state2);
+    };
+  }
+
+  /** \brief Evaluates the tiles (row, column) of the matrix on the worker threads, a single tile is evaluated on the
+      calling thread */
+  void run(const Distance_Function &distance, const State *states1, size_t n, const State *states2, size_t m,
+           bool symmetric, double *distances) const;
+
+  /** \brief Number of worker threads */
+  unsigned int nb_threads_;
+
+  /** \brief Number of rows and columns of a tile */
+  size_t tile_size_;
+
+  /** \brief Pimpl Idiom: pool of the worker threads besides the calling thread */
+  class Worker_Pool;
+
+  /** \brief Pimpl Idiom: unique pointer on the pool of worker threads */
+  unique_ptr<Worker_Pool> worker_pool_;
+};
+
+#endif
@@ -0,0 +1,35 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef DUBINS_BATCH_HPP
+#define DUBINS_BATCH_HPP
+
+#include <cstddef>
+
+namespace dubins_batch
+{
+/** \brief Stores the lengths of the shortest Dubins paths with normalized distance d[i] and the angles alpha[i] and
+    beta[i] of the start and end configuration relative to the line connecting them in lengths[i] */
+typedef void (*Lengths_Function)(const double *d, const double *alpha, const double *beta, size_t n, double *lengths);
+
+/** \brief SIMD implementations, nullptr if the compiler does not support the instruction set (defined in
+    dubins_batch_avx2.cpp and dubins_batch_avx512.cpp) */
+extern const Lengths_Function avx2_lengths;
+extern const Lengths_Function avx512_lengths;
+}
+
+#endif
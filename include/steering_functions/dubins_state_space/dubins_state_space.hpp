@@ -67,6 +67,7 @@
 #include <limits>
 #include <vector>
 
+#include "steering_functions/path_range/path_range.hpp"
 #include "steering_functions/steering_functions.hpp"
 
 using namespace std;
@@ -82,8 +83,10 @@ using namespace steer;
     A.M. Shkel and V. Lumelsky, “Classification of the Dubins set,”
     Robotics and Autonomous Systems, 34(4):179-202, 2001.
     DOI: <a href="http://dx.doi.org/10.1016/S0921-8890(00)00127-5">10.1016/S0921-8890(00)00127-5</a>
-    The classification scheme described there is not actually used,
-    since it only applies to “long” paths.
+    The classification scheme described there only applies to “long”
+    paths, where the circles at the start and end configuration are at
+    least 4 apart: in this case only the CSC words admissible for the
+    quadrants of the start and end orientation are evaluated.
     */
 class Dubins_State_Space
 {
@@ -96,6 +99,22 @@ public:
     DUBINS_RIGHT = 2
   };
 
+  /** \brief Instruction sets for the batch evaluation of the Dubins words */
+  enum Batch_Instruction_Set
+  {
+    DUBINS_BATCH_SCALAR = 0,
+    DUBINS_BATCH_AVX2 = 1,
+    DUBINS_BATCH_AVX512 = 2
+  };
+
+  /** \brief Number of queries solved by the long path classification and by evaluating all words, only recorded if
+      the library is compiled with STEERING_FUNCTIONS_INSTRUMENTATION (otherwise the counters remain zero) */
+  struct Classification_Counters
+  {
+    unsigned long long nb_long_paths;
+    unsigned long long nb_short_paths;
+  };
+
   /** \brief Dubins path types */
   static const Dubins_Path_Segment_Type dubins_path_type[6][3];
 
@@ -144,12 +163,74 @@ public:
   /** \brief Returns shortest path length from state1 to state2 with curvature = kappa_ */
   double get_distance(const State &state1, const State &state2) const;
 
+  /** \brief Returns shortest path lengths from state1 to the n states2 with curvature = kappa_ */
+  void get_distances(const State &state1, const State *states2, size_t n, double *distances) const;
+
+  /** \brief Returns shortest path lengths from (x1[i], y1[i], theta1[i]) to (x2[i], y2[i], theta2[i]) with
+      curvature = kappa_, the n pairs of states are given as structure of arrays and evaluated in SIMD lanes */
+  void get_pairwise_distances(const double *x1, const double *y1, const double *theta1, const double *x2,
+                              const double *y2, const double *theta2, size_t n, double *distances) const;
+
+  /** \brief Returns the lengths of the shortest paths with normalized distance d[i] and angles alpha[i], beta[i] of
+      the start and end state relative to the line connecting them with curvature = 1.0; 4 (AVX2) or 8 (AVX-512)
+      queries are evaluated at once, the results match the scalar implementation within 1e-9 (except for nearly
+      coinciding states, where the square root in the CSC words amplifies rounding errors to about 1e-8) */
+  static void dubins_lengths(const double *d, const double *alpha, const double *beta, size_t n, double *lengths,
+                             Batch_Instruction_Set instruction_set = get_batch_instruction_set());
+
+  /** \brief Returns the widest instruction set for dubins_lengths supported by the compiler and the CPU */
+  static Batch_Instruction_Set get_batch_instruction_set();
+
+  /** \brief Returns the classification counters of the calling thread */
+  static Classification_Counters get_classification_counters();
+
+  /** \brief Resets the classification counters of the calling thread */
+  static void reset_classification_counters();
+
   /** \brief Returns controls of the shortest path from state1 to state2 with curvature = kappa_ */
   vector<Control> get_controls(const State &state1, const State &state2) const;
 
   /** \brief Returns shortest path from state1 to state2 with curvature = kappa_ */
   vector<State> get_path(const State &state1, const State &state2) const;
 
+  /** \brief Returns a lazy range over the states of the shortest path from state1 to state2 (the states of
+      get_path) */
+  Path_Range get_path_range(const State &state1, const State &state2) const;
+
+  /** \brief Returns a lazy range over the states along the controls, the range holds the segment-prefix table for
+      repeated state_at queries */
+  Path_Range get_path_range(const State &state, const vector<Control> &dubins_controls) const;
+
+  /** \brief Returns the state at the arc length s along the controls (clamped to the length of the path); each call
+      builds the segment-prefix table of get_path_range, so repeated queries along the same controls should reuse a
+      range from get_path_range(state, controls) */
+  State state_at(const State &state, const vector<Control> &dubins_controls, double s) const;
+
+  /** \brief Returns the states at the n arc lengths s (sorted in ascending order) along the controls; the
+      segment-prefix table is built once per call, not shared between calls (see state_at) */
+  void states_at(const State &state, const vector<Control> &dubins_controls, const double *s, size_t n,
+                 State *states) const;
+
+  /** \brief Writes the states of get_path along the controls into the caller-provided arrays (structure of arrays,
+      null arrays are skipped) without allocating memory, at most capacity states are written and the number of
+      states is returned (call with capacity 0 to query the required capacity) */
+  size_t sample_path(const State &state, const vector<Control> &dubins_controls, double *x, double *y,
+                     double *theta, double *kappa, double *d, size_t capacity) const;
+
+  /** \brief Returns the states along the controls every discretization_, each state is computed in closed form from
+      the start of its segment */
+  vector<State> integrate(const State &state, const vector<Control> &dubins_controls) const;
+
+  /** \brief Returns the shortest path from state1 to state2 sampled adaptively instead of every discretization_, the
+      deviation of the path from the chords between consecutive states is bounded by tolerance (empty path if
+      tolerance is not positive and finite) */
+  vector<State> get_path_adaptive(const State &state1, const State &state2, double tolerance) const;
+
+  /** \brief Returns the states along the controls with the largest equal steps per segment for which the deviation
+      from the chords is bounded by tolerance (few states on straight lines, dense states at high curvature), empty
+      if tolerance is not positive and finite */
+  vector<State> integrate_adaptive(const State &state, const vector<Control> &dubins_controls, double tolerance) const;
+
   /** \brief Numeric integration using the forward euler method */
   vector<State> forward_euler(const State &state, const vector<Control> &dubins_controls) const;
 
@@ -60,13 +60,29 @@ public:
   /** \brief Returns a sequence of turns and straight lines connecting a start and an end configuration */
   CC_Dubins_Path* cc_dubins(const State& state1, const State& state2) const;
 
+  /** \brief Stores the shortest sequence from a start to an end configuration in path without heap allocations */
+  void cc_dubins(const State& state1, const State& state2, CC_Dubins_Path_Candidate* path) const;
+
   /** \brief Returns shortest path length from state1 to state2 */
   double get_distance(const State& state1, const State& state2) const;
 
+  /** \brief Returns shortest path lengths from state1 to the n states2, the circles at state1 are computed once */
+  void get_distances(const State& state1, const State* states2, size_t n, double* distances) const;
+
   /** \brief Returns controls of the shortest path from state1 to state2 */
   vector<Control> get_controls(const State& state1, const State& state2) const;
 
 private:
+  /** \brief Computes the 2 forward circles at the start configuration */
+  void cc_dubins_start_circles(const State& state1, HC_CC_Circle* start_circle) const;
+
+  /** \brief Computes the 2 backward circles at the end configuration */
+  void cc_dubins_end_circles(const State& state2, HC_CC_Circle* end_circle) const;
+
+  /** \brief Stores the shortest sequence between the precomputed start and end circles in path */
+  void cc_dubins(const State& state1, const HC_CC_Circle* start_circle, const State& state2,
+                 const HC_CC_Circle* end_circle, CC_Dubins_Path_Candidate* path) const;
+
   /** \brief Driving direction */
   bool forwards_;
 };
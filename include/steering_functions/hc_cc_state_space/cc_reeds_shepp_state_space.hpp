@@ -63,21 +63,33 @@ public:
   /** \brief Returns a sequence of turns and straight lines connecting the two circles c1 and c2 */
   HC_CC_RS_Path* cc_circles_rs_path(const HC_CC_Circle& c1, const HC_CC_Circle& c2) const;
 
+  /** \brief Stores the shortest sequence connecting the two circles c1 and c2 in path without heap allocations */
+  void cc_circles_rs_path(const HC_CC_Circle& c1, const HC_CC_Circle& c2, HC_CC_RS_Path_Candidate* path) const;
+
   /** \brief Returns a sequence of turns and straight lines connecting a start and an end configuration */
   HC_CC_RS_Path* cc_reeds_shepp(const State& state1, const State& state2) const;
 
+  /** \brief Stores the shortest sequence from a start to an end configuration in path without heap allocations */
+  void cc_reeds_shepp(const State& state1, const State& state2, HC_CC_RS_Path_Candidate* path) const;
+
   /** \brief Returns shortest path length from state1 to state2 */
   double get_distance(const State& state1, const State& state2) const;
 
+  /** \brief Returns shortest path lengths from state1 to the n states2, the circles at state1 are computed once */
+  void get_distances(const State& state1, const State* states2, size_t n, double* distances) const;
+
   /** \brief Returns controls of the shortest path from state1 to state2 */
   vector<Control> get_controls(const State& state1, const State& state2) const;
 
 private:
-  /** \brief Pimpl Idiom: class that contains functions to compute the families  */
-  class CC_Reeds_Shepp;
+  /** \brief Computes the 4 circles at the start configuration */
+  void cc_start_circles(const State& state1, HC_CC_Circle* start_circle) const;
+
+  /** \brief Stores the shortest sequence from the 4 precomputed start circles to an end configuration in path */
+  void cc_reeds_shepp(const HC_CC_Circle* start_circle, const State& state2, HC_CC_RS_Path_Candidate* path) const;
 
-  /** \brief Pimpl Idiom: unique pointer on class with families  */
-  unique_ptr<CC_Reeds_Shepp> cc_reeds_shepp_;
+  /** \brief Pimpl Idiom: class that contains functions to compute the families, instantiated per call */
+  class CC_Reeds_Shepp;
 };
 
 #endif
@@ -0,0 +1,47 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef FRESNEL_BATCH_HPP
+#define FRESNEL_BATCH_HPP
+
+#include <cstddef>
+
+namespace fresnel_batch
+{
+/** \brief The Fresnel integrals are evaluated with Taylor expansions of given degree around the centers of
+    intervals_per_unit equally spaced intervals per unit on [0, nb_intervals / intervals_per_unit[ */
+const int intervals_per_unit = 64;
+const int nb_intervals = 4 * intervals_per_unit;
+const int degree = 8;
+
+/** \brief Returns the coefficients of the expansions, the i-th coefficient (highest degree first) of C and S in
+    interval k is stored at index 2 * (k * (degree + 1) + i) and 2 * (k * (degree + 1) + i) + 1 (defined in
+    utilities.cpp) */
+const double *get_expansions();
+
+/** \brief Stores the Fresnel integrals of x[i] in c[i] and s[i] */
+typedef void (*Fresnel_Function)(const double *x, double *c, double *s, size_t n);
+
+/** \brief SIMD implementation, nullptr if the compiler does not support the instruction set (defined in
+    fresnel_batch_avx2.cpp) */
+extern const Fresnel_Function avx2_fresnel_cs;
+}
+
+/** \brief Scalar evaluation of the Fresnel integrals (defined in utilities.cpp) */
+void fresnel_cs(double x, double *c, double *s);
+
+#endif
@@ -61,6 +61,9 @@ public:
 class HC_CC_Circle : public HC_CC_Circle_Param
 {
 public:
+  /** \brief Default constructor (empty circle at the origin), used for value slots */
+  HC_CC_Circle();
+
   /** \brief Constructor */
   HC_CC_Circle(const Configuration &_start, bool _left, bool _forward, bool _regular, const HC_CC_Circle_Param &_param);
 
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "steering_functions/hc_cc_state_space/hc_cc_circle.hpp"
+#include "steering_functions/path_range/path_range.hpp"
 #include "steering_functions/steering_functions.hpp"
 #include "utilities.hpp"
 
@@ -34,12 +35,55 @@ public:
   /** \brief Constructor */
   HC_CC_State_Space(double kappa, double sigma, double discretization);
 
+  /** \brief Virtual function that returns the shortest path length from state1 to state2 */
+  virtual double get_distance(const State& state1, const State& state2) const = 0;
+
+  /** \brief Virtual function that returns the shortest path lengths from state1 to the n states2 */
+  virtual void get_distances(const State& state1, const State* states2, size_t n, double* distances) const;
+
   /** \brief Virtual function that returns controls of the shortest path from state1 to state2 */
   virtual vector<Control> get_controls(const State& state1, const State& state2) const = 0;
 
   /** \brief Returns path from state1 to state2 */
   vector<State> get_path(const State& state1, const State& state2) const;
 
+  /** \brief Returns a lazy range over the states of the path from state1 to state2 (the states of get_path) */
+  Path_Range get_path_range(const State& state1, const State& state2) const;
+
+  /** \brief Returns a lazy range over the states along the controls, the range holds the segment-prefix table for
+      repeated state_at queries */
+  Path_Range get_path_range(const State& state, const vector<Control>& controls) const;
+
+  /** \brief Returns the state at the arc length s along the controls (clamped to the length of the path); each call
+      builds the segment-prefix table of get_path_range, so repeated queries along the same controls should reuse a
+      range from get_path_range(state, controls) */
+  State state_at(const State& state, const vector<Control>& controls, double s) const;
+
+  /** \brief Returns the states at the n arc lengths s (sorted in ascending order) along the controls; the
+      segment-prefix table is built once per call, not shared between calls (see state_at) */
+  void states_at(const State& state, const vector<Control>& controls, const double* s, size_t n,
+                 State* states) const;
+
+  /** \brief Writes the states of get_path along the controls into the caller-provided arrays (structure of arrays,
+      null arrays are skipped) without allocating memory, at most capacity states are written and the number of
+      states is returned (call with capacity 0 to query the required capacity) */
+  size_t sample_path(const State& state, const vector<Control>& controls, double* x, double* y,
+                     double* theta, double* kappa, double* d, size_t capacity) const;
+
+  /** \brief Returns the states along the controls every discretization_, each state is computed in closed form from
+      the start of its segment (independent of the previous samples, no accumulation of errors) */
+  vector<State> integrate(const State& state, const vector<Control>& controls) const;
+
+  /** \brief Returns the shortest path from state1 to state2 sampled adaptively instead of every discretization_, the
+      deviation of the path from the chords between consecutive states is bounded by tolerance (empty path if
+      tolerance is not positive and finite) */
+  vector<State> get_path_adaptive(const State& state1, const State& state2, double tolerance) const;
+
+  /** \brief Returns the states along the controls with the largest equal steps per segment for which the deviation
+      from the chords is bounded by tolerance (few states on straight lines, dense states at high curvature), empty
+      if tolerance is not positive and finite */
+  vector<State> integrate_adaptive(const State& state, const vector<Control>& controls, double tolerance) const;
+
   /** \brief Numeric integration using the forward euler method */
   vector<State> forward_euler(const State& state, const vector<Control>& controls) const;
 
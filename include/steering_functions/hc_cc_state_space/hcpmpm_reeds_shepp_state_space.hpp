@@ -51,12 +51,26 @@ using namespace steer;
     It evaluates all Reeds-Shepp families plus the four families TTT, TcST,
     TScT, TcScT, where "T" stands for a turn, "S" for a straight line and
     "c" for a cusp, and returns the shortest path.
+    By default, the families are evaluated in the order of an admissible
+    lower bound on their length (from the heading change, the minimum
+    length of the hc-turns and the length of the straight line between
+    the circles), and families whose bound exceeds the shortest length
+    found so far are skipped. The results are identical to evaluating all
+    families.
     */
 class HCpmpm_Reeds_Shepp_State_Space : public HC_CC_State_Space
 {
 public:
+  /** \brief Number of families evaluated and skipped by the lower bound pruning, only recorded if the library is
+      compiled with STEERING_FUNCTIONS_INSTRUMENTATION (otherwise the counters remain zero) */
+  struct Pruning_Counters
+  {
+    unsigned long long nb_evaluated_families;
+    unsigned long long nb_pruned_families;
+  };
+
   /** \brief Constructor */
-  HCpmpm_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization = 0.1);
+  HCpmpm_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization = 0.1, bool pruning = true);
 
   /** \brief Destructor */
   ~HCpmpm_Reeds_Shepp_State_Space();
@@ -64,21 +78,45 @@ public:
   /** \brief Returns a sequence of turns and straight lines connecting the two circles c1 and c2 */
   HC_CC_RS_Path* hcpmpm_circles_rs_path(const HC_CC_Circle& c1, const HC_CC_Circle& c2) const;
 
+  /** \brief Stores the shortest sequence connecting the two circles c1 and c2 in path without heap allocations */
+  void hcpmpm_circles_rs_path(const HC_CC_Circle& c1, const HC_CC_Circle& c2, HC_CC_RS_Path_Candidate* path) const;
+
   /** \brief Returns a sequence of turns and straight lines connecting a start and an end configuration */
   HC_CC_RS_Path* hcpmpm_reeds_shepp(const State& state1, const State& state2) const;
 
+  /** \brief Stores the shortest sequence from a start to an end configuration in path without heap allocations */
+  void hcpmpm_reeds_shepp(const State& state1, const State& state2, HC_CC_RS_Path_Candidate* path) const;
+
   /** \brief Returns shortest path length from state1 to state2 */
   double get_distance(const State& state1, const State& state2) const;
 
+  /** \brief Returns shortest path lengths from state1 to the n states2, the circles at state1 are computed once */
+  void get_distances(const State& state1, const State* states2, size_t n, double* distances) const;
+
   /** \brief Returns controls of the shortest path from state1 to state2 */
   vector<Control> get_controls(const State& state1, const State& state2) const;
 
+  /** \brief Returns the pruning counters of the calling thread */
+  static Pruning_Counters get_pruning_counters();
+
+  /** \brief Resets the pruning counters of the calling thread */
+  static void reset_pruning_counters();
+
 private:
-  /** \brief Pimpl Idiom: class that contains functions to compute the families  */
-  class HCpmpm_Reeds_Shepp;
+  /** \brief Computes the 4 circles at the start configuration */
+  void hcpmpm_start_circles(const State& state1, HC_CC_Circle* start_circle) const;
+
+  /** \brief Stores the shortest sequence from the 4 precomputed start circles to an end configuration in path */
+  void hcpmpm_reeds_shepp(const State& state1, const HC_CC_Circle* start_circle, const State& state2,
+                          HC_CC_RS_Path_Candidate* path) const;
 
-  /** \brief Pimpl Idiom: unique pointer on class with families  */
-  unique_ptr<HCpmpm_Reeds_Shepp> hcpmpm_reeds_shepp_;
+  /** \brief Stores the shortest sequence over the nb_pairs circle pairs (c1[k], c2[k]) in path, the families are
+      evaluated in the order of their lower bounds and skipped if the bound exceeds the shortest length so far */
+  void hcpmpm_pruned_reeds_shepp(const HC_CC_Circle* const* c1, const HC_CC_Circle* const* c2, int nb_pairs,
+                                 HC_CC_RS_Path_Candidate* path) const;
+
+  /** \brief Pimpl Idiom: class that contains functions to compute the families, instantiated per call */
+  class HCpmpm_Reeds_Shepp;
 
   /** \brief Parameter of a rs-circle */
   HC_CC_Circle_Param rs_circle_param_;
@@ -91,6 +129,9 @@ private:
 
   /** \brief Sine and cosine of mu */
   double sin_mu_, cos_mu_;
+
+  /** \brief Lower bound pruning of the families */
+  bool pruning_;
 };
 
 #endif
@@ -105,6 +105,54 @@ public:
   HC_CC_Circle *cstart, *cend, *ci1, *ci2;
 };
 
+/** \brief
+    Stack-resident candidate of a cc-dubins path: the intermediate
+    configurations and circles are stored by value in fixed-size slots, so
+    that the families can be evaluated without heap allocations and only
+    the winning candidate has to be materialized as CC_Dubins_Path.
+    */
+class CC_Dubins_Path_Candidate
+{
+public:
+  /** \brief Constructor */
+  CC_Dubins_Path_Candidate();
+
+  /** \brief Reset to an empty candidate of given type with infinite length */
+  void reset(cc_dubins_path_type _type);
+
+  /** \brief Copy other into this candidate if it is shorter, ties are resolved in favor of the lower path type */
+  void assign_if_shorter(const CC_Dubins_Path_Candidate &other);
+
+  /** \brief Return the address of a slot and mark it as occupied */
+  Configuration *qi1_slot();
+  Configuration *qi2_slot();
+  HC_CC_Circle *cstart_slot();
+  HC_CC_Circle *cend_slot();
+  HC_CC_Circle *ci1_slot();
+
+  /** \brief Copy of the candidate on the heap (only occupied slots are allocated) */
+  CC_Dubins_Path *materialize(double _kappa, double _sigma) const;
+
+  /** \brief Path type */
+  cc_dubins_path_type type;
+
+  /** \brief Start and end configuration */
+  Configuration start, end;
+
+  /** \brief Path length */
+  double length;
+
+  /** \brief Intermediate configurations */
+  Configuration qi1, qi2;
+
+  /** \brief Start, end and intermediate circles */
+  HC_CC_Circle cstart, cend, ci1;
+
+private:
+  /** \brief Occupancy of the slots */
+  bool has_qi1_, has_qi2_, has_cstart_, has_cend_, has_ci1_;
+};
+
 /** \brief hc-/cc-reeds-shepp path types: T (Turn), S (Straight), c (Cusp) */
 enum hc_cc_rs_path_type
 {
@@ -155,6 +203,55 @@ public:
   HC_CC_Circle *cstart, *cend, *ci1, *ci2, *ci3;
 };
 
+/** \brief
+    Stack-resident candidate of a hc-/cc-reeds-shepp path: the intermediate
+    configurations and circles are stored by value in fixed-size slots, so
+    that the families can be evaluated without heap allocations and only
+    the winning candidate has to be materialized as HC_CC_RS_Path.
+    */
+class HC_CC_RS_Path_Candidate
+{
+public:
+  /** \brief Constructor */
+  HC_CC_RS_Path_Candidate();
+
+  /** \brief Reset to an empty candidate of given type with infinite length */
+  void reset(hc_cc_rs_path_type _type);
+
+  /** \brief Copy other into this candidate if it is strictly shorter */
+  void assign_if_shorter(const HC_CC_RS_Path_Candidate &other);
+
+  /** \brief Return the address of a slot and mark it as occupied */
+  Configuration *qi1_slot();
+  Configuration *qi2_slot();
+  Configuration *qi3_slot();
+  Configuration *qi4_slot();
+  HC_CC_Circle *cstart_slot();
+  HC_CC_Circle *cend_slot();
+  HC_CC_Circle *ci1_slot();
+  HC_CC_Circle *ci2_slot();
+
+  /** \brief Copy of the candidate on the heap (only occupied slots are allocated) */
+  HC_CC_RS_Path *materialize(const Configuration &_start, const Configuration &_end, double _kappa,
+                             double _sigma) const;
+
+  /** \brief Path type */
+  hc_cc_rs_path_type type;
+
+  /** \brief Path length */
+  double length;
+
+  /** \brief Intermediate configurations */
+  Configuration qi1, qi2, qi3, qi4;
+
+  /** \brief Start, end and intermediate circles */
+  HC_CC_Circle cstart, cend, ci1, ci2;
+
+private:
+  /** \brief Occupancy of the slots */
+  bool has_qi1_, has_qi2_, has_qi3_, has_qi4_, has_cstart_, has_cend_, has_ci1_, has_ci2_;
+};
+
 /** \brief Appends controls with 0 input */
 void empty_controls(vector<Control> &controls);
 
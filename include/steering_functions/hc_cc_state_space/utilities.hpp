@@ -28,10 +28,9 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 
-#include "steering_functions/hc_cc_state_space/fresnel.data"
-
 using namespace std;
 
 #define PI 3.1415926535897932384
@@ -64,6 +63,15 @@ float approxSin(const float x);
 /** \brief Approximation of cosine with a 8th order polynomial (absolute error is bounded by 2.6e-5 in [-pi/2, pi/2]) */
 float approxCos(const float x);
 
+/** \brief Fresnel integrals C(x) = int(cos(pi/2 * u^2), u = 0...x) and S(x) = int(sin(pi/2 * u^2), u = 0...x)
+    computed together with piecewise Taylor expansions on ]-4, 4[ and the asymptotic expansion beyond (absolute
+    error is bounded by 1e-15) */
+void fresnel_cs(double x, double *c, double *s);
+
+/** \brief Fresnel integrals of the n values x[i] stored in c[i] and s[i], evaluated in SIMD lanes (AVX2) if the CPU
+    supports it, the results are identical to the scalar evaluation */
+void fresnel_cs(const double *x, double *c, double *s, size_t n);
+
 /** \brief Fresnel integrals */
 double fresnelc(double s);
 double fresnels(double s);
@@ -78,6 +86,11 @@ double fresnels(double s);
 void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, double sigma, bool forward, double length,
                      double *x_f, double *y_f, double *theta_f, double *kappa_f);
 
+/** \brief Computation of the n end points on a clothoid with lengths[i] from the same initial configuration, the
+    Fresnel integrals are evaluated in batch and the results are identical to the scalar computation */
+void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, double sigma, bool forward,
+                     const double *lengths, size_t n, double *x_f, double *y_f, double *theta_f, double *kappa_f);
+
 /** \brief Computation of the end point on a circular arc
     x_i, y_i, theta_i, kappa_i: initial configuration
     kappa: curvature of circular arc
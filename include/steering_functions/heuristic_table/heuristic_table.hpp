@@ -0,0 +1,181 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef HEURISTIC_TABLE_HPP
+#define HEURISTIC_TABLE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "steering_functions/distance_matrix/distance_matrix.hpp"
+#include "steering_functions/steering_functions.hpp"
+
+using namespace std;
+using namespace steer;
+
+/** \brief
+    Precomputed shortest path lengths for heuristics, e.g. of a Hybrid A*.
+    The path lengths of all steering functions are invariant under rigid
+    transformations and only depend on the pose of the goal relative to the
+    start (and on the curvatures and driving directions of the start and
+    the goal, which are fixed when the table is built). The table samples
+    the get_distance function of a state space on a grid over the relative
+    pose (dx, dy, dtheta), dx and dy in [-extent, extent] and dtheta
+    periodic in [0, 2*pi). The grid is evaluated once on a pool of worker
+    threads and queried either with trilinear interpolation or as the
+    minimum of the path lengths sampled within the cell of the query (the
+    cells are subsampled). Neither is admissible in general: between the
+    samples, the path lengths can be shorter (the path lengths of the
+    steering functions are not Lipschitz continuous in the goal pose, e.g.
+    a small lateral offset requires a maneuver), so the sampled minimum
+    only approaches a lower bound with increasing subsampling.
+    A table can be saved to a versioned binary file, which is mapped
+    read-only into memory when it is loaded, so that the planners load it
+    at startup without rebuilding it and share its pages.
+    */
+class Heuristic_Table
+{
+public:
+  /** \brief Queries of the table */
+  enum Mode
+  {
+    HEURISTIC_INTERPOLATED = 0,
+    HEURISTIC_SAMPLED_MINIMUM = 1
+  };
+
+  /** \brief Grid of the table */
+  struct Parameters
+  {
+    /** \brief Max. distance of the goal to the start in x and y */
+    double extent;
+
+    /** \brief Distance of the vertices in x and y */
+    double resolution;
+
+    /** \brief Number of vertices in theta */
+    int nb_theta;
+
+    /** \brief Trilinear interpolation or sampled minimum */
+    Mode mode;
+
+    /** \brief Number of samples per cell and dimension in sampled minimum mode */
+    int nb_subsamples;
+  };
+
+  /** \brief State space of a table, which is stored in the file and compared when the file is loaded */
+  struct Description
+  {
+    /** \brief Name of the state space (at most 31 characters) */
+    string state_space;
+
+    /** \brief Max. curvature */
+    double kappa;
+
+    /** \brief Max. sharpness (0 for the Dubins and Reeds-Shepp state spaces) */
+    double sigma;
+  };
+
+  /** \brief Constructor of an empty table */
+  Heuristic_Table();
+
+  /** \brief Samples the path lengths from start to the goals with the curvature and driving direction of goal, the
+      position and orientation of start and goal are ignored; nb_threads = 0 selects the number of hardware threads */
+  void build(const Distance_Matrix::Distance_Function &distance, const Parameters &parameters,
+             const State &start = State(), const State &goal = State(), unsigned int nb_threads = 0);
+
+  /** \brief Convenience overload that samples the get_distance function of state_space */
+  template <typename State_Space>
+  void build(const State_Space &state_space, const Parameters &parameters, const State &start = State(),
+             const State &goal = State(), unsigned int nb_threads = 0)
+  {
+    Distance_Matrix::Distance_Function distance = [&state_space](const State &state1, const State &state2) {
+      return state_space.get_distance(state1, state2);
+    };
+    build(distance, parameters, start, goal, nb_threads);
+  }
+
+  /** \brief Returns the heuristic from state1 to state2; outside of the table, the Euclidean distance is returned,
+      which is a lower bound of the path lengths of all steering functions */
+  double get_distance(const State &state1, const State &state2) const;
+
+  /** \brief Returns the heuristic for the goal pose (dx, dy, dtheta) relative to the start, the Euclidean distance
+      if the pose is outside of the table or not finite */
+  double get_distance(double dx, double dy, double dtheta) const;
+
+  /** \brief Whether the goal pose (dx, dy) relative to the start lies within the table */
+  bool contains(double dx, double dy) const;
+
+  /** \brief Returns the max. range of the sampled path lengths within a cell: the max. deviation of a vertex of a
+      cell from the other vertices, or the max. amount by which the sampled minimum underestimates a sample; it
+      indicates the resolution of the table but does not bound the error between the samples */
+  double get_max_error() const;
+
+  /** \brief Returns the grid of the table */
+  const Parameters &get_parameters() const;
+
+  /** \brief Writes the table with the description of its state space to a binary file (header with format
+      version, description, grid and checksum followed by the values), returns false if the file cannot be written */
+  bool save(const string &filename, const Description &description) const;
+
+  /** \brief Maps a file written by save read-only into memory; returns false and leaves the table unchanged if the
+      file cannot be mapped, has a different format version or byte order, does not match the description or (with
+      verify_checksum) is corrupted. The mapping is released with the last copy of the table. */
+  bool load(const string &filename, const Description &description, bool verify_checksum = true);
+
+private:
+  /** \brief Samples the path lengths at the vertices (interpolated mode) */
+  void sample_vertices(const Distance_Matrix &distance_matrix, const Distance_Matrix::Distance_Function &distance,
+                       vector<float> &values);
+
+  /** \brief Samples the minima of the cells (sampled minimum mode) */
+  void sample_cells(const Distance_Matrix &distance_matrix, const Distance_Matrix::Distance_Function &distance,
+                    vector<float> &values);
+
+  /** \brief Index of the value (i, j, k) */
+  size_t index(int i, int j, int k) const
+  {
+    return (static_cast<size_t>(k) * nb_y_ + j) * nb_x_ + i;
+  }
+
+  /** \brief Grid of the table */
+  Parameters parameters_;
+
+  /** \brief Number of cells in x and y */
+  int nb_cells_;
+
+  /** \brief Number of values in x, y and theta (vertices or cells) */
+  int nb_x_, nb_y_, nb_theta_;
+
+  /** \brief Coordinate of the first vertex in x and y */
+  double origin_;
+
+  /** \brief Max. range of the sampled path lengths within a cell */
+  double max_error_;
+
+  /** \brief Curvature and driving direction of the start and the goal */
+  State start_, goal_;
+
+  /** \brief Number of values */
+  size_t nb_values_;
+
+  /** \brief Path lengths at the vertices or minima of the cells, owned by the table or mapped from a file */
+  shared_ptr<const float> values_;
+};
+
+#endif
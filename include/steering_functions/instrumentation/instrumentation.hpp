@@ -0,0 +1,180 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/* The path families of the hc-/cc-state spaces and the Reeds_Shepp_State_Space are instrumented if the library is
+   compiled with STEERING_FUNCTIONS_INSTRUMENTATION (CMake option STEERING_FUNCTIONS_ENABLE_INSTRUMENTATION). Otherwise
+   the instrumentation macros expand to nothing and the snapshots are empty. */
+
+/** \brief Instrumented state spaces */
+enum Instrumented_State_Space
+{
+  INSTRUMENTED_CC_DUBINS,
+  INSTRUMENTED_CC_REEDS_SHEPP,
+  INSTRUMENTED_HC00_REEDS_SHEPP,
+  INSTRUMENTED_HC0PM_REEDS_SHEPP,
+  INSTRUMENTED_HCPM0_REEDS_SHEPP,
+  INSTRUMENTED_HCPMPM_REEDS_SHEPP,
+  INSTRUMENTED_REEDS_SHEPP
+};
+const int nb_instrumented_state_spaces = 7;
+
+/** \brief Families of the CC_Dubins_State_Space, the subcases (e.g. LeS, eSL) are attributed to their word, the
+    hc-/cc-reeds-shepp state spaces use hc_cc_rs_path_type */
+enum cc_dubins_family
+{
+  CC_DUBINS_E,
+  CC_DUBINS_S,
+  CC_DUBINS_L,
+  CC_DUBINS_R,
+  CC_DUBINS_LSL,
+  CC_DUBINS_LSR,
+  CC_DUBINS_RSL,
+  CC_DUBINS_RSR,
+  CC_DUBINS_LRL,
+  CC_DUBINS_RLR
+};
+
+/** \brief Families of the Reeds_Shepp_State_Space (groups of formulas of the paper) */
+enum reeds_shepp_family
+{
+  RS_CSC,
+  RS_CCC,
+  RS_CCCC,
+  RS_CCSC,
+  RS_CCSCC
+};
+
+/** \brief Max. number of families of a state space */
+const int max_instrumented_families = 18;
+
+/** \brief Statistics of a path family */
+struct Family_Statistics
+{
+  /** \brief Number of existence checks of the family */
+  unsigned long long nb_evaluations;
+
+  /** \brief Number of existence checks that succeeded, i.e. the path of the family was computed (Reeds-Shepp: the
+      family improved the shortest path) */
+  unsigned long long nb_hits;
+
+  /** \brief Number of queries whose shortest path belongs to the family */
+  unsigned long long nb_wins;
+
+  /** \brief Cumulative time of the existence checks and path computations [s] */
+  double time;
+};
+
+/** \brief Statistics of a family of a state space in a snapshot */
+struct Family_Record
+{
+  /** \brief Names of the state space and the family */
+  string state_space, family;
+
+  /** \brief Statistics */
+  Family_Statistics statistics;
+};
+
+/** \brief
+    Per-family hit counters and timing of the steering functions. The
+    statistics are recorded per thread without synchronization, the
+    snapshots and resets aggregate the statistics of all threads (including
+    the finished threads and the worker threads of a Distance_Matrix). They
+    have to be called while no other thread evaluates steering functions,
+    e.g. after the threads were joined or Distance_Matrix::compute returned.
+    Unlike the statistics, the pruning counters of the
+    HCpmpm_Reeds_Shepp_State_Space and the classification counters of the
+    Dubins_State_Space refer to the calling thread.
+    */
+class Instrumentation
+{
+public:
+  /** \brief Whether the library is compiled with instrumentation */
+  static bool enabled();
+
+  /** \brief Returns the statistics of all families of the instrumented state spaces summed over all threads */
+  static vector<Family_Record> snapshot();
+
+  /** \brief Resets the statistics of all threads */
+  static void reset();
+
+  /** \brief Writes a snapshot as CSV with the header state_space,family,evaluations,hits,hit_rate,wins,time */
+  static void dump(ostream &out);
+
+  /** \brief Returns the statistics of a family of the calling thread for recording */
+  static Family_Statistics &statistics(Instrumented_State_Space state_space, int family);
+};
+
+/** \brief Records the evaluation (optional), the hits and the elapsed time of a family */
+class Family_Probe
+{
+public:
+  Family_Probe(Instrumented_State_Space state_space, int family, bool evaluation = true)
+    : statistics_(Instrumentation::statistics(state_space, family)), start_(chrono::steady_clock::now())
+  {
+    if (evaluation)
+      statistics_.nb_evaluations++;
+  }
+
+  void hit()
+  {
+    statistics_.nb_hits++;
+  }
+
+  void stop()
+  {
+    statistics_.time += chrono::duration<double>(chrono::steady_clock::now() - start_).count();
+  }
+
+private:
+  Family_Statistics &statistics_;
+  chrono::steady_clock::time_point start_;
+};
+
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+/** \brief Starts the existence check of a family (the family is an identifier, it names the probe) */
+#define INSTRUMENTATION_FAMILY_BEGIN(state_space, family) Family_Probe family##_probe(state_space, family)
+/** \brief Continues the timing of a family that was already evaluated (without counting an evaluation) */
+#define INSTRUMENTATION_FAMILY_RESUME(state_space, family) Family_Probe family##_probe(state_space, family, false)
+/** \brief Marks the existence check of a family as successful */
+#define INSTRUMENTATION_FAMILY_HIT(family) family##_probe.hit()
+#define INSTRUMENTATION_FAMILY_HIT_IF(family, condition)                                                             \
+  if (condition)                                                                                                       \
+  family##_probe.hit()
+/** \brief Stops the timing of a family */
+#define INSTRUMENTATION_FAMILY_END(family) family##_probe.stop()
+/** \brief Counts the shortest path of a query */
+#define INSTRUMENTATION_FAMILY_WIN(state_space, family) Instrumentation::statistics(state_space, family).nb_wins++
+#else
+#define INSTRUMENTATION_FAMILY_BEGIN(state_space, family)
+#define INSTRUMENTATION_FAMILY_RESUME(state_space, family)
+#define INSTRUMENTATION_FAMILY_HIT(family)
+#define INSTRUMENTATION_FAMILY_HIT_IF(family, condition)
+#define INSTRUMENTATION_FAMILY_END(family)
+#define INSTRUMENTATION_FAMILY_WIN(state_space, family)
+#endif
+
+#endif
@@ -0,0 +1,248 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef PATH_RANGE_HPP
+#define PATH_RANGE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "steering_functions/steering_functions.hpp"
+
+using namespace std;
+using namespace steer;
+
+/** \brief
+    Lazy range over the states of a path sampled every discretization along
+    the controls. The states are computed on demand in closed form from the
+    start of their segment, iterating does not allocate memory and can be
+    stopped at any state. The states are identical to the ones returned by
+    get_path of the state space that created the range.
+    */
+class Path_Range
+{
+public:
+  /** \brief Conventions of the state spaces for the sampled states */
+  struct Convention
+  {
+    /** \brief Normalization of the heading on circular arcs and straight lines */
+    double (*normalize_theta)(double theta);
+
+    /** \brief The hc-/cc-state spaces start with a single state (also for empty controls) and repeat a state only at
+        curvature discontinuities, the Dubins and Reeds-Shepp state spaces repeat the first state of every segment */
+    bool hc_cc;
+  };
+
+  /** \brief Forward iterator over the states */
+  class Iterator
+  {
+  public:
+    typedef forward_iterator_tag iterator_category;
+    typedef State value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const State *pointer;
+    typedef const State &reference;
+
+    /** \brief Constructor of the end iterator */
+    Iterator() : range_(nullptr), index_(0), segment_(0), position_(0)
+    {
+    }
+
+    const State &operator*() const
+    {
+      return state_;
+    }
+    const State *operator->() const
+    {
+      return &state_;
+    }
+    Iterator &operator++();
+    Iterator operator++(int)
+    {
+      Iterator it = *this;
+      ++(*this);
+      return it;
+    }
+    bool operator==(const Iterator &other) const
+    {
+      return index_ == other.index_;
+    }
+    bool operator!=(const Iterator &other) const
+    {
+      return index_ != other.index_;
+    }
+
+    /** \brief Index of the current state in the path */
+    size_t index() const
+    {
+      return index_;
+    }
+
+    /** \brief Arc length from the start of the path to the current state */
+    double arc_length() const;
+
+  private:
+    /** \brief Constructor of an iterator on a state of a segment */
+    Iterator(const Path_Range *range, size_t index, int segment, int position);
+
+    /** \brief Range */
+    const Path_Range *range_;
+
+    /** \brief Index of the state in the path, index of the segment (-1 for the first state of hc-/cc-state spaces)
+        and position of the state in the segment */
+    size_t index_;
+    int segment_, position_;
+
+    /** \brief Current state */
+    State state_;
+
+    friend class Path_Range;
+  };
+
+  typedef Iterator iterator;
+  typedef Iterator const_iterator;
+
+  /** \brief Constructor, the states at the start of the segments are computed once */
+  Path_Range(const State &start, const vector<Control> &controls, double discretization, const Convention &convention);
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  /** \brief Number of states */
+  size_t size() const
+  {
+    return size_;
+  }
+
+  /** \brief Arc length of the path */
+  double length() const;
+
+  /** \brief Returns an iterator on the first state with an arc length of at least s from the start of the path (end()
+      if s exceeds the length), only the segment of s is evaluated */
+  Iterator seek(double s) const;
+
+  /** \brief Returns the state at the arc length s from the start of the path (clamped to [0, length()]), the segment
+      of s is found by binary search and evaluated once in closed form */
+  State state_at(double s) const;
+
+  /** \brief Returns the states at the n arc lengths s sorted in ascending order, the segments are traversed once */
+  void states_at(const double *s, size_t n, State *states) const;
+
+  /** \brief Writes the states along the controls into the caller-provided arrays x, y, theta, kappa and d (structure
+      of arrays, null arrays are skipped) without allocating memory. At most capacity states are written, the number
+      of states of the path is returned, i.e. a call with capacity 0 queries the required capacity. */
+  static size_t sample(const State &start, const vector<Control> &controls, double discretization,
+                       const Convention &convention, double *x, double *y, double *theta, double *kappa, double *d,
+                       size_t capacity);
+
+  /** \brief Returns the states along the controls sampled every discretization, used by the integrate functions of
+      the state spaces */
+  static vector<State> sample(const State &start, const vector<Control> &controls, double discretization,
+                              const Convention &convention);
+
+  /** \brief Returns the states along the controls sampled with the largest equal steps per segment for which the
+      deviation of the path from the chords between consecutive states does not exceed tolerance: straight lines are
+      represented by their end states, circular arcs and clothoids are sampled according to their curvature. The
+      path is empty if tolerance is not positive and finite. */
+  static vector<State> sample_adaptive(const State &start, const vector<Control> &controls, double tolerance,
+                                       const Convention &convention);
+
+  /** \brief Controls of the path */
+  const vector<Control> &get_controls() const
+  {
+    return controls_;
+  }
+
+private:
+  /** \brief Segment of the path with its precomputed start state */
+  struct Segment
+  {
+    /** \brief State from which the samples are computed */
+    State start;
+
+    /** \brief Arc length from the start of the path to the start of the segment and length of the segment */
+    double s_start, length;
+
+    /** \brief Index of the first state of the segment in the path */
+    size_t first_index;
+
+    /** \brief Number of states of the segment including the repeated start state and number of samples */
+    int nb_states, nb_samples;
+
+    /** \brief Whether the first state is the repeated start state */
+    bool repeated_start;
+
+    /** \brief Whether the segment is below the resolution of the arc length and leaves the state unchanged */
+    bool degenerate;
+  };
+
+  /** \brief Returns the state at a position of a segment */
+  State state(int segment, int position) const;
+
+  /** \brief Returns the first state of the path */
+  static State first_state(const State &start, const vector<Control> &controls, const Convention &convention);
+
+  /** \brief Returns the segment of a control that starts at the last state of the previous segment */
+  static Segment make_segment(const Control &control, const State &state_prev, double s_start, size_t first_index,
+                              double discretization, const Convention &convention);
+
+  /** \brief Returns the last state of a segment (the start of the next segment) */
+  static State last_state(const Segment &segment, const Control &control, double discretization,
+                          const Convention &convention);
+
+  /** \brief Appends the states of a segment to path and returns its last state */
+  static State append_segment(const Segment &segment, const Control &control, double discretization,
+                              const Convention &convention, vector<State> *path);
+
+  /** \brief Returns the largest step on a segment for which the deviation from the chord is bounded by tolerance */
+  static double adaptive_step(const Segment &segment, const Control &control, double tolerance);
+
+  /** \brief Returns the state at the arc length s relative to the start of a segment */
+  static State segment_state(const Segment &segment, const Control &control, double s, const Convention &convention);
+
+  /** \brief Writes the states at the n arc lengths s relative to the start of a segment, the terms that do not
+      depend on the arc length are computed once */
+  static void segment_states(const Segment &segment, const Control &control, const double *s, size_t n,
+                             const Convention &convention, State *states);
+
+  /** \brief Returns the arc length of a position of a segment relative to the start of the segment */
+  static double segment_arc_length(const Segment &segment, int position, double discretization);
+
+  /** \brief Returns the index of the first segment that reaches the arc length s (clamped to [0, length()]) */
+  int find_segment(double s) const;
+
+  /** \brief Start state */
+  State start_;
+
+  /** \brief Controls */
+  vector<Control> controls_;
+
+  /** \brief Segments */
+  vector<Segment> segments_;
+
+  /** \brief Discretization of path */
+  double discretization_;
+
+  /** \brief Conventions of the state space */
+  Convention convention_;
+
+  /** \brief Number of states */
+  size_t size_;
+};
+
+#endif
@@ -0,0 +1,35 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef REEDS_SHEPP_BATCH_HPP
+#define REEDS_SHEPP_BATCH_HPP
+
+#include <cstddef>
+
+namespace reeds_shepp_batch
+{
+/** \brief Stores the lengths of the shortest Reeds-Shepp paths from the origin to (x[i], y[i], phi[i]) with
+    curvature = 1.0 in lengths[i] */
+typedef void (*Lengths_Function)(const double *x, const double *y, const double *phi, size_t n, double *lengths);
+
+/** \brief SIMD implementations, nullptr if the compiler does not support the instruction set (defined in
+    reeds_shepp_batch_avx2.cpp and reeds_shepp_batch_avx512.cpp) */
+extern const Lengths_Function avx2_lengths;
+extern const Lengths_Function avx512_lengths;
+}
+
+#endif
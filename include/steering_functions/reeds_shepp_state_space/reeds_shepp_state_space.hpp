@@ -62,10 +62,12 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <vector>
 
+#include "steering_functions/path_range/path_range.hpp"
 #include "steering_functions/steering_functions.hpp"
 
 using namespace std;
@@ -77,9 +79,11 @@ using namespace steer;
     J.A. Reeds and L.A. Shepp, “Optimal paths for a car that goes both
     forwards and backwards,” Pacific Journal of Mathematics,
     145(2):367–393, 1990.
-    This implementation explicitly computes all 48 Reeds-Shepp curves
-    and returns the shortest valid solution. This can be improved by
-    using the configuration space partition described in:
+    By default, this implementation explicitly computes all 48 Reeds-Shepp
+    curves and returns the shortest valid solution. Alternatively, only the
+    curves that can be shortest in the canonical quadrant of the symmetry
+    group are computed, or only the curves of the domain of the query in a
+    sampled configuration space partition, following the idea of:
     P. Souères and J.-P. Laumond, “Shortest paths synthesis for a
     car-like robot,” IEEE Trans. on Automatic Control, 41(5):672–688,
     May 1996.
@@ -96,6 +100,28 @@ public:
     RS_RIGHT = 3
   };
 
+  /** \brief Instruction sets for the batch evaluation of the Reeds-Shepp formulas */
+  enum Batch_Instruction_Set
+  {
+    RS_BATCH_SCALAR = 0,
+    RS_BATCH_AVX2 = 1,
+    RS_BATCH_AVX512 = 2
+  };
+
+  /** \brief Solvers for the shortest path: all curves, the curves of the domain in the configuration space
+      partition, or the curves that can be shortest after the query is mapped to x >= 0, y >= 0 by the timeflip and
+      reflect symmetries (20 instead of 44 evaluations of the formulas, the lengths match up to rounding errors of
+      equally long curves). The partition is sampled once (about 0.2 s) by the first state space constructed with
+      RS_SOLVER_PARTITION and shared by all state spaces. It is validated empirically, not derived exactly: the domains
+      are sampled on a 32 x 16 x 64 grid, so a domain thinner than a cell can be missed, in which case a shorter curve
+      of another family may be returned. */
+  enum Solver
+  {
+    RS_SOLVER_EXHAUSTIVE = 0,
+    RS_SOLVER_PARTITION = 1,
+    RS_SOLVER_CANONICAL = 2
+  };
+
   /** \brief Reeds-Shepp path types */
   static const Reeds_Shepp_Path_Segment_Type reeds_shepp_path_type[18][5];
 
@@ -127,10 +153,7 @@ public:
   };
 
   /** \brief Constructor of the Reeds_Shepp_State_Space */
-  Reeds_Shepp_State_Space(double kappa, double discretization = 0.1) : kappa_(kappa), discretization_(discretization)
-  {
-    kappa_inv_ = 1 / kappa;
-  }
+  Reeds_Shepp_State_Space(double kappa, double discretization = 0.1, Solver solver = RS_SOLVER_EXHAUSTIVE);
 
   /** \brief Returns type and length of segments of path from state1 to state2 with curvature = 1.0 */
   Reeds_Shepp_Path reeds_shepp(const State &state1, const State &state2) const;
@@ -138,12 +161,75 @@ public:
   /** \brief Returns shortest path length from state1 to state2 with curvature = kappa_ */
   double get_distance(const State &state1, const State &state2) const;
 
+  /** \brief Returns shortest path lengths from state1 to the n states2 with curvature = kappa_ */
+  void get_distances(const State &state1, const State *states2, size_t n, double *distances) const;
+
+  /** \brief Returns shortest path lengths from (x1[i], y1[i], theta1[i]) to (x2[i], y2[i], theta2[i]) with
+      curvature = kappa_, the n pairs of states are given as structure of arrays and evaluated in SIMD lanes */
+  void get_pairwise_distances(const double *x1, const double *y1, const double *theta1, const double *x2,
+                              const double *y2, const double *theta2, size_t n, double *distances) const;
+
+  /** \brief Returns the lengths of the shortest paths from the origin to (x[i], y[i], phi[i]) with curvature = 1.0;
+      4 (AVX2) or 8 (AVX-512) queries are evaluated at once, the results match the scalar implementation within 1e-9 */
+  static void reeds_shepp_lengths(const double *x, const double *y, const double *phi, size_t n, double *lengths,
+                                  Batch_Instruction_Set instruction_set = get_batch_instruction_set());
+
+  /** \brief Returns the widest instruction set for reeds_shepp_lengths supported by the compiler and the CPU */
+  static Batch_Instruction_Set get_batch_instruction_set();
+
+  /** \brief Returns the candidates evaluated by RS_SOLVER_CANONICAL for x >= 0, y >= 0 (bit i: i-th of the 44
+      candidates in the order of evaluation, groups of four per formula: base, timeflip, reflect, timeflip + reflect) */
+  static uint64_t get_canonical_candidates();
+
+  /** \brief Returns the candidate (as in get_canonical_candidates) that yields the unique shortest path from the
+      origin to (x, y, phi) with curvature = 1.0, or 0 if several candidates are within 1e-9 of the shortest */
+  static uint64_t get_unique_shortest_candidate(double x, double y, double phi);
+
   /** \brief Returns controls of the shortest path from state1 to state2 with curvature = kappa_ */
   vector<Control> get_controls(const State &state1, const State &state2) const;
 
   /** \brief Returns shortest path from state1 to state2 with curvature = kappa_ */
   vector<State> get_path(const State &state1, const State &state2) const;
 
+  /** \brief Returns a lazy range over the states of the shortest path from state1 to state2 (the states of
+      get_path) */
+  Path_Range get_path_range(const State &state1, const State &state2) const;
+
+  /** \brief Returns a lazy range over the states along the controls, the range holds the segment-prefix table for
+      repeated state_at queries */
+  Path_Range get_path_range(const State &state, const vector<Control> &reeds_shepp_controls) const;
+
+  /** \brief Returns the state at the arc length s along the controls (clamped to the length of the path); each call
+      builds the segment-prefix table of get_path_range, so repeated queries along the same controls should reuse a
+      range from get_path_range(state, controls) */
+  State state_at(const State &state, const vector<Control> &reeds_shepp_controls, double s) const;
+
+  /** \brief Returns the states at the n arc lengths s (sorted in ascending order) along the controls; the
+      segment-prefix table is built once per call, not shared between calls (see state_at) */
+  void states_at(const State &state, const vector<Control> &reeds_shepp_controls, const double *s, size_t n,
+                 State *states) const;
+
+  /** \brief Writes the states of get_path along the controls into the caller-provided arrays (structure of arrays,
+      null arrays are skipped) without allocating memory, at most capacity states are written and the number of
+      states is returned (call with capacity 0 to query the required capacity) */
+  size_t sample_path(const State &state, const vector<Control> &reeds_shepp_controls, double *x, double *y,
+                     double *theta, double *kappa, double *d, size_t capacity) const;
+
+  /** \brief Returns the states along the controls every discretization_, each state is computed in closed form from
+      the start of its segment */
+  vector<State> integrate(const State &state, const vector<Control> &reeds_shepp_controls) const;
+
+  /** \brief Returns the shortest path from state1 to state2 sampled adaptively instead of every discretization_, the
+      deviation of the path from the chords between consecutive states is bounded by tolerance (empty path if
+      tolerance is not positive and finite) */
+  vector<State> get_path_adaptive(const State &state1, const State &state2, double tolerance) const;
+
+  /** \brief Returns the states along the controls with the largest equal steps per segment for which the deviation
+      from the chords is bounded by tolerance (few states on straight lines, dense states at high curvature), empty
+      if tolerance is not positive and finite */
+  vector<State> integrate_adaptive(const State &state, const vector<Control> &reeds_shepp_controls,
+                                   double tolerance) const;
+
   /** \brief Numeric integration using the forward euler method */
   vector<State> forward_euler(const State &state, const vector<Control> &reeds_shepp_controls) const;
 
@@ -156,6 +242,9 @@ private:
 
   /** \brief Discretization of path */
   double discretization_;
+
+  /** \brief Solver for the shortest path */
+  Solver solver_;
 };
 
 #endif
@@ -0,0 +1,63 @@
+#*********************************************************************
+#  Copyright (c) 2017 Robert Bosch GmbH.
+#  All rights reserved.
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# *********************************************************************/
+
+# Plots the per-family statistics written by the unit test if the library is built with
+# STEERING_FUNCTIONS_ENABLE_INSTRUMENTATION (Instrumentation::dump)
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+CSV_HEADER = "state_space,family,evaluations,hits,hit_rate,wins,time".split(",")
+
+def read_csv(filename):
+    with open(filename, 'r') as f:
+        next(f)
+        lines = [line.strip().split(",") for line in f.readlines()]
+        return lines
+
+if __name__ == "__main__":
+    # load data
+    filepath = "../test/"
+    stats = read_csv(filepath + "family_stats.csv")
+
+    state_spaces = []
+    for stat in stats:
+        if stat[CSV_HEADER.index("state_space")] not in state_spaces:
+            state_spaces.append(stat[CSV_HEADER.index("state_space")])
+
+    # plot hit rate, share of wins and share of time of the families
+    f, axes = plt.subplots(len(state_spaces), 1, figsize=(10, 3 * len(state_spaces)))
+    f.subplots_adjust(hspace=.8)
+    for ax, state_space in zip(axes, state_spaces):
+        rows = [stat for stat in stats if stat[CSV_HEADER.index("state_space")] == state_space]
+        families = [row[CSV_HEADER.index("family")] for row in rows]
+        hit_rate = np.array([float(row[CSV_HEADER.index("hit_rate")]) for row in rows])
+        wins = np.array([float(row[CSV_HEADER.index("wins")]) for row in rows])
+        time = np.array([float(row[CSV_HEADER.index("time")]) for row in rows])
+        x = np.arange(len(families))
+        ax.bar(x - .25, 100 * hit_rate, width=.25, label='Hit Rate')
+        ax.bar(x, 100 * wins / max(wins.sum(), 1), width=.25, label='Wins')
+        ax.bar(x + .25, 100 * time / max(time.sum(), 1e-12), width=.25, label='Time')
+        ax.set_xticks(x)
+        ax.set_xticklabels(families, rotation=45)
+        ax.set_title(state_space)
+        ax.set_ylabel('[%]')
+        ax.grid('on')
+    axes[0].legend(loc='best')
+
+    f.savefig('../doc/images/family_statistics.png', bbox_inches='tight', pad_inches=0)
+    plt.show()
@@ -0,0 +1,156 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "steering_functions/controls_cache/controls_cache.hpp"
+
+namespace
+{
+const double twopi = 2. * M_PI;
+
+uint64_t bits(double value)
+{
+  uint64_t word;
+  memcpy(&word, &value, sizeof(word));
+  return word;
+}
+}
+
+Controls_Cache::Controls_Cache(size_t capacity, size_t nb_shards, double resolution, double angular_resolution)
+  : resolution_(max(resolution, 0.0))
+  , angular_resolution_(angular_resolution > 0.0 ? angular_resolution : resolution_)
+  , nb_shards_(max<size_t>(nb_shards, 1))
+  , nb_hits_(0)
+  , nb_misses_(0)
+  , nb_evictions_(0)
+{
+  shard_capacity_ = max<size_t>((capacity + nb_shards_ - 1) / nb_shards_, 1);
+  shards_.reset(new Shard[nb_shards_]);
+}
+
+size_t Controls_Cache::Key_Hash::operator()(const Key &key) const
+{
+  uint64_t hash = 0;
+  for (uint64_t word : key)
+  {
+    // mixing function of splitmix64
+    hash += word + 0x9e3779b97f4a7c15ull;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    hash ^= hash >> 31;
+  }
+  return hash;
+}
+
+Controls_Cache::Key Controls_Cache::get_key(const State &state1, const State &state2) const
+{
+  Key key;
+  if (resolution_ == 0.0)
+  {
+    key = { { bits(state1.x), bits(state1.y), bits(state1.theta), bits(state1.kappa), bits(state1.d), bits(state2.x),
+              bits(state2.y), bits(state2.theta), bits(state2.kappa), bits(state2.d) } };
+    return key;
+  }
+  // relative pose of state2 in the frame of state1, the orientation is wrapped to the cells of [0, 2*pi)
+  double c = cos(state1.theta), s = sin(state1.theta);
+  double dx = state2.x - state1.x, dy = state2.y - state1.y;
+  double dtheta = fmod(state2.theta - state1.theta, twopi);
+  if (dtheta < 0)
+    dtheta += twopi;
+  long long nb_theta_cells = max(llround(twopi / angular_resolution_), 1ll);
+  long long theta_cell = llround(dtheta / angular_resolution_);
+  if (theta_cell >= nb_theta_cells)
+    theta_cell -= nb_theta_cells;
+  key = { { static_cast<uint64_t>(llround((c * dx + s * dy) / resolution_)),
+            static_cast<uint64_t>(llround((-s * dx + c * dy) / resolution_)), static_cast<uint64_t>(theta_cell),
+            bits(state1.kappa), bits(state1.d), bits(state2.kappa), bits(state2.d), 0, 0, 0 } };
+  return key;
+}
+
+Controls_Cache::Shard &Controls_Cache::get_shard(const Key &key) const
+{
+  return shards_[(Key_Hash()(key) >> 32) % nb_shards_];
+}
+
+bool Controls_Cache::lookup(const State &state1, const State &state2, vector<Control> *controls)
+{
+  Key key = get_key(state1, state2);
+  Shard &shard = get_shard(key);
+  {
+    lock_guard<mutex> guard(shard.lock);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+      // move the entry to the front of the LRU list
+      shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+      *controls = it->second->second;
+      nb_hits_++;
+      return true;
+    }
+  }
+  nb_misses_++;
+  return false;
+}
+
+void Controls_Cache::insert(const State &state1, const State &state2, const vector<Control> &controls)
+{
+  Key key = get_key(state1, state2);
+  Shard &shard = get_shard(key);
+  lock_guard<mutex> guard(shard.lock);
+  auto it = shard.index.find(key);
+  if (it != shard.index.end())
+  {
+    // inserted concurrently by another thread
+    it->second->second = controls;
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return;
+  }
+  if (shard.entries.size() >= shard_capacity_)
+  {
+    shard.index.erase(shard.entries.back().first);
+    shard.entries.pop_back();
+    nb_evictions_++;
+  }
+  shard.entries.push_front(make_pair(key, controls));
+  shard.index[key] = shard.entries.begin();
+}
+
+void Controls_Cache::clear()
+{
+  for (size_t i = 0; i < nb_shards_; i++)
+  {
+    lock_guard<mutex> guard(shards_[i].lock);
+    shards_[i].entries.clear();
+    shards_[i].index.clear();
+  }
+  nb_hits_ = 0;
+  nb_misses_ = 0;
+  nb_evictions_ = 0;
+}
+
+Controls_Cache::Statistics Controls_Cache::get_statistics() const
+{
+  Statistics statistics = { nb_hits_, nb_misses_, nb_evictions_, 0 };
+  for (size_t i = 0; i < nb_shards_; i++)
+  {
+    lock_guard<mutex> guard(shards_[i].lock);
+    statistics.size += shards_[i].entries.size();
+  }
+  return statistics;
+}
@@ -0,0 +1,210 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "steering_functions/distance_matrix/distance_matrix.hpp"
+
+class Distance_Matrix::Worker_Pool
+{
+public:
+  /** \brief Constructor, starts the worker threads */
+  explicit Worker_Pool(unsigned int nb_workers)
+    : job_(nullptr), generation_(0), nb_requested_(0), nb_running_(0), stop_(false)
+  {
+    workers_.reserve(nb_workers);
+    for (unsigned int t = 0; t < nb_workers; t++)
+      workers_.push_back(thread(&Worker_Pool::work, this));
+  }
+
+  /** \brief Destructor, stops and joins the worker threads */
+  ~Worker_Pool()
+  {
+    {
+      lock_guard<mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (auto &worker : workers_)
+      worker.join();
+  }
+
+  /** \brief Runs job on the calling thread and on nb_workers worker threads, returns once all of them finished;
+      the first exception thrown by job on any of the threads is rethrown after all of them finished */
+  void run(const function<void()> &job, size_t nb_workers)
+  {
+    lock_guard<mutex> run_lock(run_mutex_);
+    {
+      lock_guard<mutex> lock(mutex_);
+      job_ = &job;
+      exception_ = nullptr;
+      nb_requested_ = nb_running_ = min(nb_workers, workers_.size());
+      generation_++;
+    }
+    start_.notify_all();
+    exception_ptr exception = call(job);
+    // the workers refer to job until they finished, even if it threw on the calling thread
+    unique_lock<mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return nb_running_ == 0; });
+    job_ = nullptr;
+    if (!exception)
+      exception = exception_;
+    exception_ = nullptr;
+    lock.unlock();
+    if (exception)
+      rethrow_exception(exception);
+  }
+
+private:
+  /** \brief Loop of a worker thread, each job is run by the first nb_requested_ workers that wake up */
+  void work()
+  {
+    size_t generation = 0;
+    unique_lock<mutex> lock(mutex_);
+    while (true)
+    {
+      start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+      if (stop_)
+        return;
+      generation = generation_;
+      if (nb_requested_ == 0)
+        continue;
+      nb_requested_--;
+      const function<void()> &job = *job_;
+      lock.unlock();
+      exception_ptr exception = call(job);
+      lock.lock();
+      if (exception && !exception_)
+        exception_ = exception;
+      if (--nb_running_ == 0)
+        done_.notify_one();
+    }
+  }
+
+  /** \brief Runs job and returns the exception it threw, if any */
+  static exception_ptr call(const function<void()> &job)
+  {
+    try
+    {
+      job();
+    }
+    catch (...)
+    {
+      return current_exception();
+    }
+    return nullptr;
+  }
+
+  /** \brief Worker threads */
+  vector<thread> workers_;
+
+  /** \brief Serializes the calls of run */
+  mutex run_mutex_;
+
+  /** \brief Protects the state of the current job */
+  mutex mutex_;
+
+  /** \brief Signals a new job or the stop to the workers and the completion of the job to run */
+  condition_variable start_, done_;
+
+  /** \brief Current job */
+  const function<void()> *job_;
+
+  /** \brief First exception thrown by the current job on a worker thread */
+  exception_ptr exception_;
+
+  /** \brief Number of the current job, number of workers that still have to start it and that did not finish it */
+  size_t generation_, nb_requested_, nb_running_;
+
+  /** \brief Whether the workers have to stop */
+  bool stop_;
+};
+
+Distance_Matrix::Distance_Matrix(unsigned int nb_threads, size_t tile_size)
+  : nb_threads_(nb_threads), tile_size_(max<size_t>(tile_size, 1))
+{
+  if (nb_threads_ == 0)
+    nb_threads_ = max(thread::hardware_concurrency(), 1u);
+  // the calling thread is one of the workers
+  worker_pool_ = unique_ptr<Worker_Pool>(new Worker_Pool(nb_threads_ - 1));
+}
+
+Distance_Matrix::~Distance_Matrix() = default;
+
+unsigned int Distance_Matrix::get_nb_threads() const
+{
+  return nb_threads_;
+}
+
+void Distance_Matrix::compute(const Distance_Function &distance, const State *states1, size_t n,
+                              const State *states2, size_t m, double *distances) const
+{
+  run(distance, states1, n, states2, m, false, distances);
+}
+
+void Distance_Matrix::compute_symmetric(const Distance_Function &distance, const State *states, size_t n,
+                                        double *distances) const
+{
+  run(distance, states, n, states, n, true, distances);
+}
+
+void Distance_Matrix::run(const Distance_Function &distance, const State *states1, size_t n, const State *states2,
+                          size_t m, bool symmetric, double *distances) const
+{
+  // enumerate the tiles, in symmetric mode only the tiles on and above the diagonal
+  size_t nb_tile_rows = (n + tile_size_ - 1) / tile_size_;
+  size_t nb_tile_cols = (m + tile_size_ - 1) / tile_size_;
+  vector<pair<size_t, size_t>> tiles;
+  tiles.reserve(nb_tile_rows * nb_tile_cols);
+  for (size_t row = 0; row < nb_tile_rows; row++)
+  {
+    for (size_t col = symmetric ? row : 0; col < nb_tile_cols; col++)
+      tiles.push_back(make_pair(row, col));
+  }
+
+  // the workers fetch the next tile from a shared counter until all tiles are evaluated
+  atomic<size_t> next_tile(0);
+  function<void()> worker = [&]() {
+    for (size_t k = next_tile++; k < tiles.size(); k = next_tile++)
+    {
+      size_t i_begin = tiles[k].first * tile_size_, i_end = min(i_begin + tile_size_, n);
+      size_t j_begin = tiles[k].second * tile_size_, j_end = min(j_begin + tile_size_, m);
+      for (size_t i = i_begin; i < i_end; i++)
+      {
+        for (size_t j = symmetric ? max(i, j_begin) : j_begin; j < j_end; j++)
+        {
+          distances[i * m + j] = distance(states1[i], states2[j]);
+          if (symmetric)
+            distances[j * m + i] = distances[i * m + j];
+        }
+      }
+    }
+  };
+
+  // a single tile is not worth waking up the pool
+  if (tiles.size() <= 1)
+    worker();
+  else
+    worker_pool_->run(worker, min<size_t>(nb_threads_, tiles.size()) - 1);
+}
@@ -0,0 +1,39 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include "steering_functions/dubins_state_space/dubins_batch.hpp"
+
+#if defined(__AVX512F__)
+
+#include "dubins_state_space/dubins_batch_kernel.hpp"
+#include "simd/simd_avx512.hpp"
+
+namespace
+{
+void lengths(const double *d, const double *alpha, const double *beta, size_t n, double *lengths)
+{
+  Dubins_Kernel<Avx512>::lengths(d, alpha, beta, n, lengths);
+}
+}
+
+const dubins_batch::Lengths_Function dubins_batch::avx512_lengths = lengths;
+
+#else
+
+const dubins_batch::Lengths_Function dubins_batch::avx512_lengths = nullptr;
+
+#endif
@@ -0,0 +1,179 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef DUBINS_BATCH_KERNEL_HPP
+#define DUBINS_BATCH_KERNEL_HPP
+
+#include <cstddef>
+#include <limits>
+
+#include "simd/simd.hpp"
+
+namespace
+{
+/** \brief
+    SIMD version of the six Dubins words in dubins_state_space.cpp. Each word is evaluated on all lanes and invalid
+    words are masked with an infinite length. The basic arithmetic is carried out in the same order as in the scalar
+    code (the translation units are compiled with -ffp-contract=off), only sin, cos, atan2 and acos are replaced by
+    polynomial approximations (Cephes) that differ from the C library by a few ulp.
+    */
+template <typename Isa>
+class Dubins_Kernel
+{
+public:
+  typedef Vec<Isa> V;
+  typedef Mask<Isa> M;
+
+  /** \brief Stores the lengths of the shortest paths for (d[i], alpha[i], beta[i]) in lengths[i] */
+  static void lengths(const double *d, const double *alpha, const double *beta, size_t n, double *lengths)
+  {
+    const size_t width = Isa::WIDTH;
+    size_t i = 0;
+    for (; i + width <= n; i += width)
+    {
+      V length = dubins(Isa::load(d + i), Isa::load(alpha + i), Isa::load(beta + i));
+      Isa::store(lengths + i, length.v);
+    }
+    if (i < n)
+    {
+      // the remaining queries are padded with empty paths
+      double d_rem[Isa::WIDTH] = { 0 }, alpha_rem[Isa::WIDTH] = { 0 }, beta_rem[Isa::WIDTH] = { 0 };
+      double lengths_rem[Isa::WIDTH];
+      for (size_t j = i; j < n; j++)
+      {
+        d_rem[j - i] = d[j];
+        alpha_rem[j - i] = alpha[j];
+        beta_rem[j - i] = beta[j];
+      }
+      V length = dubins(Isa::load(d_rem), Isa::load(alpha_rem), Isa::load(beta_rem));
+      Isa::store(lengths_rem, length.v);
+      for (size_t j = i; j < n; j++)
+        lengths[j] = lengths_rem[j - i];
+    }
+  }
+
+private:
+  static V mod2pi(const V &x)
+  {
+    return select((x < V(0.)) & (x > V(zero())), V(0.), x - V(twopi()) * floor(x / V(twopi())));
+  }
+  static V max0(const V &x)
+  {
+    return select(x < V(0.), V(0.), x);
+  }
+  /** \brief Length t + p + q of a valid word, infinite length otherwise */
+  static V length(const M &valid, const V &t, const V &p, const V &q)
+  {
+    return select(valid, t + p + q, V(numeric_limits_max()));
+  }
+
+  static V dubinsLSL(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = V(2.) + d * d - V(2.) * (ca * cb + sa * sb - d * (sa - sb));
+    V theta = atan2(cb - ca, d + sa - sb);
+    V t = mod2pi(-alpha + theta);
+    V p = sqrt(max0(tmp));
+    V q = mod2pi(beta - theta);
+    return length(tmp >= V(zero()), t, p, q);
+  }
+  static V dubinsRSR(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = V(2.) + d * d - V(2.) * (ca * cb + sa * sb - d * (sb - sa));
+    V theta = atan2(ca - cb, d - sa + sb);
+    V t = mod2pi(alpha - theta);
+    V p = sqrt(max0(tmp));
+    V q = mod2pi(-beta + theta);
+    return length(tmp >= V(zero()), t, p, q);
+  }
+  static V dubinsRSL(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = d * d - V(2.) + V(2.) * (ca * cb + sa * sb - d * (sa + sb));
+    V p = sqrt(max0(tmp));
+    V theta = atan2(ca + cb, d - sa - sb) - atan2(V(2.), p);
+    V t = mod2pi(alpha - theta);
+    V q = mod2pi(beta - theta);
+    return length(tmp >= V(zero()), t, p, q);
+  }
+  static V dubinsLSR(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = V(-2.) + d * d + V(2.) * (ca * cb + sa * sb + d * (sa + sb));
+    V p = sqrt(max0(tmp));
+    V theta = atan2(-ca - cb, d + sa + sb) - atan2(V(-2.), p);
+    V t = mod2pi(-alpha + theta);
+    V q = mod2pi(-beta + theta);
+    return length(tmp >= V(zero()), t, p, q);
+  }
+  static V dubinsRLR(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = V(.125) * (V(6.) - d * d + V(2.) * (ca * cb + sa * sb + d * (sa - sb)));
+    V p = V(twopi()) - acos(tmp);
+    V theta = atan2(ca - cb, d - sa + sb);
+    V t = mod2pi(alpha - theta + V(.5) * p);
+    V q = mod2pi(alpha - beta - t + p);
+    return length(fabs(tmp) < V(1.), t, p, q);
+  }
+  static V dubinsLRL(const V &d, const V &alpha, const V &beta, const V &ca, const V &sa, const V &cb, const V &sb)
+  {
+    V tmp = V(.125) * (V(6.) - d * d + V(2.) * (ca * cb + sa * sb - d * (sa - sb)));
+    V p = V(twopi()) - acos(tmp);
+    V theta = atan2(-ca + cb, d + sa - sb);
+    V t = mod2pi(-alpha + theta + V(.5) * p);
+    V q = mod2pi(beta - alpha - t + p);
+    return length(fabs(tmp) < V(1.), t, p, q);
+  }
+
+  static V dubins(const V &d, const V &alpha, const V &beta)
+  {
+    V ca, sa, cb, sb;
+    sincos(alpha, sa, ca);
+    sincos(beta, sb, cb);
+    // shortest word, ties are resolved in favor of the first word as in the scalar code
+    V length = dubinsLSL(d, alpha, beta, ca, sa, cb, sb), tmp;
+    tmp = dubinsRSR(d, alpha, beta, ca, sa, cb, sb);
+    length = select(tmp < length, tmp, length);
+    tmp = dubinsRSL(d, alpha, beta, ca, sa, cb, sb);
+    length = select(tmp < length, tmp, length);
+    tmp = dubinsLSR(d, alpha, beta, ca, sa, cb, sb);
+    length = select(tmp < length, tmp, length);
+    tmp = dubinsRLR(d, alpha, beta, ca, sa, cb, sb);
+    length = select(tmp < length, tmp, length);
+    tmp = dubinsLRL(d, alpha, beta, ca, sa, cb, sb);
+    length = select(tmp < length, tmp, length);
+    // coinciding configurations
+    return select((d < V(eps())) & (fabs(alpha - beta) < V(eps())), d, length);
+  }
+
+  static double twopi()
+  {
+    return 2. * M_PI;
+  }
+  static double eps()
+  {
+    return 1e-6;
+  }
+  static double zero()
+  {
+    return -1e-9;
+  }
+  static double numeric_limits_max()
+  {
+    return std::numeric_limits<double>::max();
+  }
+};
+}
+
+#endif
@@ -57,7 +57,9 @@
 *  POSSIBILITY OF SUCH DAMAGE.
 *********************************************************************/
 
+#include "steering_functions/dubins_state_space/dubins_batch.hpp"
 #include "steering_functions/dubins_state_space/dubins_state_space.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 
 namespace
 {
@@ -77,9 +79,9 @@ inline double mod2pi(double x)
   return x - twopi * floor(x / twopi);
 }
 
-Dubins_State_Space::Dubins_Path dubinsLSL(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsLSL(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = 2. + d * d - 2. * (ca * cb + sa * sb - d * (sa - sb));
   if (tmp >= DUBINS_ZERO)
   {
@@ -95,9 +97,9 @@ Dubins_State_Space::Dubins_Path dubinsLSL(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
-Dubins_State_Space::Dubins_Path dubinsRSR(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsRSR(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = 2. + d * d - 2. * (ca * cb + sa * sb - d * (sb - sa));
   if (tmp >= DUBINS_ZERO)
   {
@@ -113,9 +115,9 @@ Dubins_State_Space::Dubins_Path dubinsRSR(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
-Dubins_State_Space::Dubins_Path dubinsRSL(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsRSL(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = d * d - 2. + 2. * (ca * cb + sa * sb - d * (sa + sb));
   if (tmp >= DUBINS_ZERO)
   {
@@ -131,9 +133,9 @@ Dubins_State_Space::Dubins_Path dubinsRSL(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
-Dubins_State_Space::Dubins_Path dubinsLSR(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsLSR(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = -2. + d * d + 2. * (ca * cb + sa * sb + d * (sa + sb));
   if (tmp >= DUBINS_ZERO)
   {
@@ -149,9 +151,9 @@ Dubins_State_Space::Dubins_Path dubinsLSR(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
-Dubins_State_Space::Dubins_Path dubinsRLR(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsRLR(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = .125 * (6. - d * d + 2. * (ca * cb + sa * sb + d * (sa - sb)));
   if (fabs(tmp) < 1.)
   {
@@ -167,9 +169,9 @@ Dubins_State_Space::Dubins_Path dubinsRLR(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
-Dubins_State_Space::Dubins_Path dubinsLRL(double d, double alpha, double beta)
+Dubins_State_Space::Dubins_Path dubinsLRL(double d, double alpha, double beta, double ca, double sa, double cb,
+                                         double sb)
 {
-  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
   double tmp = .125 * (6. - d * d + 2. * (ca * cb + sa * sb - d * (sa - sb)));
   if (fabs(tmp) < 1.)
   {
@@ -185,40 +187,80 @@ Dubins_State_Space::Dubins_Path dubinsLRL(double d, double alpha, double beta)
   return Dubins_State_Space::Dubins_Path();
 }
 
+typedef Dubins_State_Space::Dubins_Path (*Dubins_Word)(double d, double alpha, double beta, double ca, double sa,
+                                                        double cb, double sb);
+const Dubins_Word dubins_words[6] = { dubinsLSL, dubinsRSR, dubinsRSL, dubinsLSR, dubinsRLR, dubinsLRL };
+const int nb_dubins_words = 6;
+const int all_dubins_words = (1 << nb_dubins_words) - 1;
+
+// CSC words that can be optimal in the long path case, indexed by the quadrants of alpha and beta; this corresponds to
+// the classification of the Dubins set by Shkel and Lumelsky (bit i is set for dubins_path_type[i])
+const int LSL = 1 << 0, RSR = 1 << 1, RSL = 1 << 2, LSR = 1 << 3;
+const int long_path_words[4][4] = { { RSL, RSR | RSL | LSR, RSR | LSR, RSR | RSL | LSR },
+                                    { LSL | RSL | LSR, LSL | RSR | RSL, RSR, RSR | RSL },
+                                    { LSL | LSR, LSL, LSL | RSR | LSR, RSR | RSL | LSR },
+                                    { LSL | RSL | LSR, LSL | RSL, LSL | RSL | LSR, LSR } };
+
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+thread_local Dubins_State_Space::Classification_Counters classification_counters = { 0, 0 };
+#endif
+
+inline int quadrant(double angle)
+{
+  double q = angle / (.5 * M_PI);
+  // angles within DUBINS_EPS of a quadrant boundary are not classified
+  if (fabs(q - round(q)) * .5 * M_PI < DUBINS_EPS)
+    return -1;
+  return min(int(q), 3);
+}
+
+// Returns the words that have to be evaluated: in the long path case, where the circles at the start and end
+// configuration are at least 4 apart, the CCC words are infeasible and the CSC words follow from the classification
+int dubins_words_to_evaluate(double d, double alpha, double beta, double ca, double sa, double cb, double sb)
+{
+  double left_left = (d - sb + sa) * (d - sb + sa) + (cb - ca) * (cb - ca);
+  double right_right = (d + sb - sa) * (d + sb - sa) + (cb - ca) * (cb - ca);
+  double left_right = (d + sb + sa) * (d + sb + sa) + (cb + ca) * (cb + ca);
+  double right_left = (d - sb - sa) * (d - sb - sa) + (cb + ca) * (cb + ca);
+  if (min(min(left_left, right_right), min(left_right, right_left)) > 16. + DUBINS_EPS)
+  {
+    int quadrant_alpha = quadrant(alpha), quadrant_beta = quadrant(beta);
+    if (quadrant_alpha >= 0 && quadrant_beta >= 0)
+    {
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+      classification_counters.nb_long_paths++;
+#endif
+      return long_path_words[quadrant_alpha][quadrant_beta];
+    }
+  }
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  classification_counters.nb_short_paths++;
+#endif
+  return all_dubins_words;
+}
+
 Dubins_State_Space::Dubins_Path dubins(double d, double alpha, double beta)
 {
   if (d < DUBINS_EPS && fabs(alpha - beta) < DUBINS_EPS)
     return Dubins_State_Space::Dubins_Path(Dubins_State_Space::dubins_path_type[0], 0, d, 0);
 
-  Dubins_State_Space::Dubins_Path path(dubinsLSL(d, alpha, beta)), tmp(dubinsRSR(d, alpha, beta));
-  double len, minLength = path.length();
-
-  if ((len = tmp.length()) < minLength)
-  {
-    minLength = len;
-    path = tmp;
-  }
-  tmp = dubinsRSL(d, alpha, beta);
-  if ((len = tmp.length()) < minLength)
-  {
-    minLength = len;
-    path = tmp;
-  }
-  tmp = dubinsLSR(d, alpha, beta);
-  if ((len = tmp.length()) < minLength)
-  {
-    minLength = len;
-    path = tmp;
-  }
-  tmp = dubinsRLR(d, alpha, beta);
-  if ((len = tmp.length()) < minLength)
+  double ca = cos(alpha), sa = sin(alpha), cb = cos(beta), sb = sin(beta);
+  int words = dubins_words_to_evaluate(d, alpha, beta, ca, sa, cb, sb);
+  // the shortest word, ties are resolved in favor of the first word
+  Dubins_State_Space::Dubins_Path path, tmp;
+  double minLength = path.length();
+  for (int i = 0; i < nb_dubins_words; i++)
   {
-    minLength = len;
-    path = tmp;
+    if (words & (1 << i))
+    {
+      tmp = dubins_words[i](d, alpha, beta, ca, sa, cb, sb);
+      if (tmp.length() < minLength)
+      {
+        minLength = tmp.length();
+        path = tmp;
+      }
+    }
   }
-  tmp = dubinsLRL(d, alpha, beta);
-  if ((tmp.length()) < minLength)
-    path = tmp;
   return path;
 }
 }
@@ -244,6 +286,95 @@ double Dubins_State_Space::get_distance(const State &state1, const State &state2
     return kappa_inv_ * this->dubins(state2, state1).length();
 }
 
+void Dubins_State_Space::get_distances(const State &state1, const State *states2, size_t n, double *distances) const
+{
+  if (forwards_)
+    for (size_t i = 0; i < n; i++)
+      distances[i] = kappa_inv_ * this->dubins(state1, states2[i]).length();
+  else
+    for (size_t i = 0; i < n; i++)
+      distances[i] = kappa_inv_ * this->dubins(states2[i], state1).length();
+}
+
+void Dubins_State_Space::get_pairwise_distances(const double *x1, const double *y1, const double *theta1,
+                                                const double *x2, const double *y2, const double *theta2, size_t n,
+                                                double *distances) const
+{
+  // compute the normalized distances and angles in blocks on the stack
+  const size_t block_size = 256;
+  double d[block_size], alpha[block_size], beta[block_size];
+  Batch_Instruction_Set instruction_set = get_batch_instruction_set();
+  for (size_t i = 0; i < n; i += block_size)
+  {
+    size_t m = min(block_size, n - i);
+    for (size_t j = 0; j < m; j++)
+    {
+      State state1, state2;
+      state1.x = x1[i + j];
+      state1.y = y1[i + j];
+      state1.theta = theta1[i + j];
+      state2.x = x2[i + j];
+      state2.y = y2[i + j];
+      state2.theta = theta2[i + j];
+      if (!forwards_)
+        swap(state1, state2);
+      double dx = state2.x - state1.x, dy = state2.y - state1.y, th = atan2(dy, dx);
+      d[j] = sqrt(dx * dx + dy * dy) * kappa_;
+      alpha[j] = mod2pi(state1.theta - th);
+      beta[j] = mod2pi(state2.theta - th);
+    }
+    dubins_lengths(d, alpha, beta, m, distances + i, instruction_set);
+    for (size_t j = 0; j < m; j++)
+      distances[i + j] *= kappa_inv_;
+  }
+}
+
+void Dubins_State_Space::dubins_lengths(const double *d, const double *alpha, const double *beta, size_t n,
+                                        double *lengths, Batch_Instruction_Set instruction_set)
+{
+  instruction_set = min(instruction_set, get_batch_instruction_set());
+  if (instruction_set == DUBINS_BATCH_AVX512)
+    dubins_batch::avx512_lengths(d, alpha, beta, n, lengths);
+  else if (instruction_set == DUBINS_BATCH_AVX2)
+    dubins_batch::avx2_lengths(d, alpha, beta, n, lengths);
+  else
+    for (size_t i = 0; i < n; i++)
+      lengths[i] = ::dubins(d[i], alpha[i], beta[i]).length();
+}
+
+Dubins_State_Space::Batch_Instruction_Set Dubins_State_Space::get_batch_instruction_set()
+{
+  // the CPU is queried once
+  static const Batch_Instruction_Set instruction_set = []() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (dubins_batch::avx512_lengths && __builtin_cpu_supports("avx512f"))
+      return DUBINS_BATCH_AVX512;
+    if (dubins_batch::avx2_lengths && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return DUBINS_BATCH_AVX2;
+#endif
+    return DUBINS_BATCH_SCALAR;
+  }();
+  return instruction_set;
+}
+
+Dubins_State_Space::Classification_Counters Dubins_State_Space::get_classification_counters()
+{
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  return classification_counters;
+#else
+  Classification_Counters counters = { 0, 0 };
+  return counters;
+#endif
+}
+
+void Dubins_State_Space::reset_classification_counters()
+{
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  classification_counters = { 0, 0 };
+#endif
+}
+
 vector<Control> Dubins_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> dubins_controls;
@@ -289,7 +420,54 @@ vector<Control> Dubins_State_Space::get_controls(const State &state1, const Stat
 vector<State> Dubins_State_Space::get_path(const State &state1, const State &state2) const
 {
   vector<Control> dubins_controls = this->get_controls(state1, state2);
-  return this->forward_euler(state1, dubins_controls);
+  return this->integrate(state1, dubins_controls);
+}
+
+Path_Range Dubins_State_Space::get_path_range(const State &state1, const State &state2) const
+{
+  return this->get_path_range(state1, this->get_controls(state1, state2));
+}
+
+Path_Range Dubins_State_Space::get_path_range(const State &state, const vector<Control> &dubins_controls) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range(state, dubins_controls, discretization_, convention);
+}
+
+State Dubins_State_Space::state_at(const State &state, const vector<Control> &dubins_controls, double s) const
+{
+  return this->get_path_range(state, dubins_controls).state_at(s);
+}
+
+void Dubins_State_Space::states_at(const State &state, const vector<Control> &dubins_controls, const double *s,
+                                   size_t n, State *states) const
+{
+  this->get_path_range(state, dubins_controls).states_at(s, n, states);
+}
+
+size_t Dubins_State_Space::sample_path(const State &state, const vector<Control> &dubins_controls, double *x, double *y,
+                                       double *theta, double *kappa, double *d, size_t capacity) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample(state, dubins_controls, discretization_, convention, x, y, theta, kappa, d, capacity);
+}
+
+vector<State> Dubins_State_Space::integrate(const State &state, const vector<Control> &dubins_controls) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample(state, dubins_controls, discretization_, convention);
+}
+
+vector<State> Dubins_State_Space::get_path_adaptive(const State &state1, const State &state2, double tolerance) const
+{
+  return this->integrate_adaptive(state1, this->get_controls(state1, state2), tolerance);
+}
+
+vector<State> Dubins_State_Space::integrate_adaptive(const State &state, const vector<Control> &dubins_controls,
+                                                     double tolerance) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample_adaptive(state, dubins_controls, tolerance, convention);
 }
 
 vector<State> Dubins_State_Space::forward_euler(const State &state, const vector<Control> &dubins_controls) const
@@ -24,6 +24,7 @@
 **********************************************************************/
 
 #include "steering_functions/hc_cc_state_space/cc_dubins_state_space.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 
 namespace cc_dubins
 {
@@ -49,7 +50,7 @@ bool external_mu_tangent_exists(const HC_CC_Circle &c1, const HC_CC_Circle &c2)
   return (distance >= 2 * c1.radius * c1.sin_mu);
 }
 
-void external_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+void external_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
 {
   double theta = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
   double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -58,16 +59,16 @@ void external_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configu
   if (c1.left && c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta, 0);
+    *q1 = Configuration(x, y, theta, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
   }
   if (!c1.left && c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta, 0);
+    *q1 = Configuration(x, y, theta, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
   }
 }
 
@@ -85,7 +86,7 @@ bool internal_mu_tangent_exists(const HC_CC_Circle &c1, const HC_CC_Circle &c2)
   return (distance >= 2 * c1.radius);
 }
 
-void internal_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+void internal_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
 {
   double distance = point_distance(c1.xc, c1.yc, c2.xc, c2.yc);
   double theta = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
@@ -97,17 +98,17 @@ void internal_mu_tangent(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configu
   {
     theta = theta + alpha;
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta, 0);
+    *q1 = Configuration(x, y, theta, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
   }
   if (!c1.left && c1.forward)
   {
     theta = theta - alpha;
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta, 0);
+    *q1 = Configuration(x, y, theta, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
   }
 }
 
@@ -125,8 +126,8 @@ bool tangent_circle_exists(const HC_CC_Circle &c1, const HC_CC_Circle &c2)
   return (distance <= 4 * c1.radius);
 }
 
-void tangent_circle(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                    Configuration **q3, Configuration **q4)
+void tangent_circle(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                    Configuration *q3, Configuration *q4)
 {
   double distance = point_distance(c1.xc, c1.yc, c2.xc, c2.yc);
   double theta = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
@@ -138,376 +139,461 @@ void tangent_circle(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuratio
   if (c1.left && c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta + alpha + HALF_PI - c1.mu, 0);
+    *q1 = Configuration(x, y, theta + alpha + HALF_PI - c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta - alpha + 1.5 * PI + c1.mu, 0);
+    *q2 = Configuration(x, y, theta - alpha + 1.5 * PI + c1.mu, 0);
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q3 = new Configuration(x, y, theta - alpha + HALF_PI - c1.mu, 0);
+    *q3 = Configuration(x, y, theta - alpha + HALF_PI - c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q4 = new Configuration(x, y, theta + alpha + 1.5 * PI + c1.mu, 0);
+    *q4 = Configuration(x, y, theta + alpha + 1.5 * PI + c1.mu, 0);
   }
   if (c1.left && !c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta - alpha + HALF_PI + c1.mu, 0);
+    *q1 = Configuration(x, y, theta - alpha + HALF_PI + c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta + alpha + 1.5 * PI - c1.mu, 0);
+    *q2 = Configuration(x, y, theta + alpha + 1.5 * PI - c1.mu, 0);
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q3 = new Configuration(x, y, theta + alpha + HALF_PI + c1.mu, 0);
+    *q3 = Configuration(x, y, theta + alpha + HALF_PI + c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q4 = new Configuration(x, y, theta - alpha + 1.5 * PI - c1.mu, 0);
+    *q4 = Configuration(x, y, theta - alpha + 1.5 * PI - c1.mu, 0);
   }
   if (!c1.left && c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta - alpha - HALF_PI + c1.mu, 0);
+    *q1 = Configuration(x, y, theta - alpha - HALF_PI + c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta + alpha + HALF_PI - c1.mu, 0);
+    *q2 = Configuration(x, y, theta + alpha + HALF_PI - c1.mu, 0);
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q3 = new Configuration(x, y, theta + alpha - HALF_PI + c1.mu, 0);
+    *q3 = Configuration(x, y, theta + alpha - HALF_PI + c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q4 = new Configuration(x, y, theta - alpha + HALF_PI - c1.mu, 0);
+    *q4 = Configuration(x, y, theta - alpha + HALF_PI - c1.mu, 0);
   }
   if (!c1.left && !c1.forward)
   {
     global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-    *q1 = new Configuration(x, y, theta + alpha - HALF_PI - c1.mu, 0);
+    *q1 = Configuration(x, y, theta + alpha - HALF_PI - c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-    *q2 = new Configuration(x, y, theta - alpha + HALF_PI + c1.mu, 0);
+    *q2 = Configuration(x, y, theta - alpha + HALF_PI + c1.mu, 0);
     global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-    *q3 = new Configuration(x, y, theta - alpha - HALF_PI - c1.mu, 0);
+    *q3 = Configuration(x, y, theta - alpha - HALF_PI - c1.mu, 0);
     global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-    *q4 = new Configuration(x, y, theta + alpha - HALF_PI + c1.mu, 0);
+    *q4 = Configuration(x, y, theta + alpha - HALF_PI + c1.mu, 0);
   }
 }
+
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+/** \brief Returns the word of a path type (E, S, L and R are handled before the words) */
+cc_dubins_family family(cc_dubins_path_type type)
+{
+  switch (type)
+  {
+    case LSL:
+    case LeS:
+    case eSL:
+      return CC_DUBINS_LSL;
+    case LSR:
+    case LiS:
+    case iSR:
+      return CC_DUBINS_LSR;
+    case RSL:
+    case RiS:
+    case iSL:
+      return CC_DUBINS_RSL;
+    case RSR:
+    case ReS:
+    case eSR:
+      return CC_DUBINS_RSR;
+    case LR1L:
+    case LR2L:
+      return CC_DUBINS_LRL;
+    case RL1R:
+    case RL2R:
+      return CC_DUBINS_RLR;
+    default:
+      return CC_DUBINS_E;
+  }
+}
+#endif
 }
 
-CC_Dubins_Path *CC_Dubins_State_Space::cc_dubins(const State &state1, const State &state2) const
+void CC_Dubins_State_Space::cc_dubins_start_circles(const State &state1, HC_CC_Circle *start_circle) const
 {
-  // table containing the lengths of the paths, the intermediate configurations and circles
-  double length[nb_cc_dubins_paths];
-  double_array_init(length, nb_cc_dubins_paths, numeric_limits<double>::max());
-  Configuration *qi1[nb_cc_dubins_paths];
-  pointer_array_init((void **)qi1, nb_cc_dubins_paths);
-  Configuration *qi2[nb_cc_dubins_paths];
-  pointer_array_init((void **)qi2, nb_cc_dubins_paths);
-  HC_CC_Circle *cstart[nb_cc_dubins_paths];
-  pointer_array_init((void **)cstart, nb_cc_dubins_paths);
-  HC_CC_Circle *ci1[nb_cc_dubins_paths];
-  pointer_array_init((void **)ci1, nb_cc_dubins_paths);
-  HC_CC_Circle *cend[nb_cc_dubins_paths];
-  pointer_array_init((void **)cend, nb_cc_dubins_paths);
+  // compute the 2 circles at the initial configuration
+  Configuration start(state1.x, state1.y, state1.theta, 0.0);
+  start_circle[0] = HC_CC_Circle(start, true, true, true, hc_cc_circle_param_);
+  start_circle[1] = HC_CC_Circle(start, false, true, true, hc_cc_circle_param_);
+}
 
-  // compute the 2 circles at the intial and final configuration
+void CC_Dubins_State_Space::cc_dubins_end_circles(const State &state2, HC_CC_Circle *end_circle) const
+{
+  // compute the 2 circles at the final configuration
+  Configuration end(state2.x, state2.y, state2.theta, 0.0);
+  end_circle[0] = HC_CC_Circle(end, true, false, true, hc_cc_circle_param_);
+  end_circle[1] = HC_CC_Circle(end, false, false, true, hc_cc_circle_param_);
+}
+
+void CC_Dubins_State_Space::cc_dubins(const State &state1, const HC_CC_Circle *start_circle, const State &state2,
+                                      const HC_CC_Circle *end_circle, CC_Dubins_Path_Candidate *path) const
+{
   Configuration start(state1.x, state1.y, state1.theta, 0.0);
   Configuration end(state2.x, state2.y, state2.theta, 0.0);
 
-  HC_CC_Circle *start_left_forward, *start_right_forward;
-  HC_CC_Circle *end_left_backward, *end_right_backward;
-  start_left_forward = new HC_CC_Circle(start, true, true, true, hc_cc_circle_param_);
-  start_right_forward = new HC_CC_Circle(start, false, true, true, hc_cc_circle_param_);
-  end_left_backward = new HC_CC_Circle(end, true, false, true, hc_cc_circle_param_);
-  end_right_backward = new HC_CC_Circle(end, false, false, true, hc_cc_circle_param_);
+  const HC_CC_Circle &start_left_forward = start_circle[0];
+  const HC_CC_Circle &start_right_forward = start_circle[1];
+  const HC_CC_Circle &end_left_backward = end_circle[0];
+  const HC_CC_Circle &end_right_backward = end_circle[1];
+
+  // slot of the family under evaluation, the shortest family is kept in path
+  CC_Dubins_Path_Candidate candidate;
+  path->reset(E);
+  path->start = start;
+  path->end = end;
+  candidate.start = start;
+  candidate.end = end;
 
   // case Empty
   if (configuration_equal(start, end))
   {
-    length[E] = 0;
-    goto label_end;
+    path->length = 0;
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_E);
+    return;
   }
   // case Straight
   if (configuration_aligned(start, end))
   {
-    length[S] = configuration_distance(start, end);
-    goto label_end;
+    path->reset(S);
+    path->length = configuration_distance(start, end);
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_S);
+    return;
   }
   // case Left
-  if (configuration_on_hc_cc_circle(*start_left_forward, end))
+  if (configuration_on_hc_cc_circle(start_left_forward, end))
   {
-    cstart[L] = new HC_CC_Circle(*start_left_forward);
-    length[L] = start_left_forward->cc_turn_length(end);
-    goto label_end;
+    path->reset(L);
+    *path->cstart_slot() = start_left_forward;
+    path->length = start_left_forward.cc_turn_length(end);
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_L);
+    return;
   }
   // case Right
-  if (configuration_on_hc_cc_circle(*start_right_forward, end))
+  if (configuration_on_hc_cc_circle(start_right_forward, end))
   {
-    cstart[R] = new HC_CC_Circle(*start_right_forward);
-    length[R] = start_right_forward->cc_turn_length(end);
-    goto label_end;
+    path->reset(R);
+    *path->cstart_slot() = start_right_forward;
+    path->length = start_right_forward.cc_turn_length(end);
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_R);
+    return;
   }
   // case LSL and subcases LeS, eSL
-  if (cc_dubins::external_mu_tangent_exists(*start_left_forward, *end_left_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_LSL);
+  if (cc_dubins::external_mu_tangent_exists(start_left_forward, end_left_backward))
   {
-    Configuration *qa, *qb;
-    cc_dubins::external_mu_tangent(*start_left_forward, *end_left_backward, &qa, &qb);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_LSL);
+    Configuration qa, qb;
+    cc_dubins::external_mu_tangent(start_left_forward, end_left_backward, &qa, &qb);
     // subcase LeS
-    if (configuration_aligned(*qb, end))
+    if (configuration_aligned(qb, end))
     {
-      cstart[LeS] = new HC_CC_Circle(*start_left_forward);
-      qi1[LeS] = new Configuration(*qa);
-      length[LeS] = start_left_forward->cc_turn_length(*qa) + configuration_distance(*qa, end);
+      candidate.reset(LeS);
+      *candidate.cstart_slot() = start_left_forward;
+      *candidate.qi1_slot() = qa;
+      candidate.length = start_left_forward.cc_turn_length(qa) + configuration_distance(qa, end);
     }
     // subcase eSL
-    else if (configuration_aligned(start, *qa))
+    else if (configuration_aligned(start, qa))
     {
-      cend[eSL] = new HC_CC_Circle(*end_left_backward);
-      qi1[eSL] = new Configuration(*qb);
-      length[eSL] = configuration_distance(start, *qb) + end_left_backward->cc_turn_length(*qb);
+      candidate.reset(eSL);
+      *candidate.cend_slot() = end_left_backward;
+      *candidate.qi1_slot() = qb;
+      candidate.length = configuration_distance(start, qb) + end_left_backward.cc_turn_length(qb);
     }
     // case LSL
     else
     {
-      cstart[LSL] = new HC_CC_Circle(*start_left_forward);
-      cend[LSL] = new HC_CC_Circle(*end_left_backward);
-      qi1[LSL] = new Configuration(*qa);
-      qi2[LSL] = new Configuration(*qb);
-      length[LSL] = start_left_forward->cc_turn_length(*qa) + configuration_distance(*qa, *qb) +
-                    end_left_backward->cc_turn_length(*qb);
+      candidate.reset(LSL);
+      *candidate.cstart_slot() = start_left_forward;
+      *candidate.cend_slot() = end_left_backward;
+      *candidate.qi1_slot() = qa;
+      *candidate.qi2_slot() = qb;
+      candidate.length = start_left_forward.cc_turn_length(qa) + configuration_distance(qa, qb) +
+                         end_left_backward.cc_turn_length(qb);
     }
-    delete qa;
-    delete qb;
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_LSL);
   // case LSR and subcases LiS, iSR
-  if (cc_dubins::internal_mu_tangent_exists(*start_left_forward, *end_right_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_LSR);
+  if (cc_dubins::internal_mu_tangent_exists(start_left_forward, end_right_backward))
   {
-    Configuration *qa, *qb;
-    cc_dubins::internal_mu_tangent(*start_left_forward, *end_right_backward, &qa, &qb);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_LSR);
+    Configuration qa, qb;
+    cc_dubins::internal_mu_tangent(start_left_forward, end_right_backward, &qa, &qb);
     // subcase LiS
-    if (configuration_aligned(*qb, end))
+    if (configuration_aligned(qb, end))
     {
-      cstart[LiS] = new HC_CC_Circle(*start_left_forward);
-      qi1[LiS] = new Configuration(*qa);
-      length[LiS] = start_left_forward->cc_turn_length(*qa) + configuration_distance(*qa, end);
+      candidate.reset(LiS);
+      *candidate.cstart_slot() = start_left_forward;
+      *candidate.qi1_slot() = qa;
+      candidate.length = start_left_forward.cc_turn_length(qa) + configuration_distance(qa, end);
     }
     // subcase iSR
-    else if (configuration_aligned(start, *qa))
+    else if (configuration_aligned(start, qa))
     {
-      cend[iSR] = new HC_CC_Circle(*end_right_backward);
-      qi1[iSR] = new Configuration(*qb);
-      length[iSR] = configuration_distance(start, *qb) + end_right_backward->cc_turn_length(*qb);
+      candidate.reset(iSR);
+      *candidate.cend_slot() = end_right_backward;
+      *candidate.qi1_slot() = qb;
+      candidate.length = configuration_distance(start, qb) + end_right_backward.cc_turn_length(qb);
     }
     // case LSR
     else
     {
-      cstart[LSR] = new HC_CC_Circle(*start_left_forward);
-      cend[LSR] = new HC_CC_Circle(*end_right_backward);
-      qi1[LSR] = new Configuration(*qa);
-      qi2[LSR] = new Configuration(*qb);
-      length[LSR] = start_left_forward->cc_turn_length(*qa) + configuration_distance(*qa, *qb) +
-                    end_right_backward->cc_turn_length(*qb);
+      candidate.reset(LSR);
+      *candidate.cstart_slot() = start_left_forward;
+      *candidate.cend_slot() = end_right_backward;
+      *candidate.qi1_slot() = qa;
+      *candidate.qi2_slot() = qb;
+      candidate.length = start_left_forward.cc_turn_length(qa) + configuration_distance(qa, qb) +
+                         end_right_backward.cc_turn_length(qb);
     }
-    delete qa;
-    delete qb;
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_LSR);
   // case RSL and subcases RiS, iSL
-  if (cc_dubins::internal_mu_tangent_exists(*start_right_forward, *end_left_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_RSL);
+  if (cc_dubins::internal_mu_tangent_exists(start_right_forward, end_left_backward))
   {
-    Configuration *qa, *qb;
-    cc_dubins::internal_mu_tangent(*start_right_forward, *end_left_backward, &qa, &qb);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_RSL);
+    Configuration qa, qb;
+    cc_dubins::internal_mu_tangent(start_right_forward, end_left_backward, &qa, &qb);
     // subcase RiS
-    if (configuration_aligned(*qb, end))
+    if (configuration_aligned(qb, end))
     {
-      cstart[RiS] = new HC_CC_Circle(*start_right_forward);
-      qi1[RiS] = new Configuration(*qa);
-      length[RiS] = start_right_forward->cc_turn_length(*qa) + configuration_distance(*qa, end);
+      candidate.reset(RiS);
+      *candidate.cstart_slot() = start_right_forward;
+      *candidate.qi1_slot() = qa;
+      candidate.length = start_right_forward.cc_turn_length(qa) + configuration_distance(qa, end);
     }
     // subcase iSL
-    else if (configuration_aligned(start, *qa))
+    else if (configuration_aligned(start, qa))
     {
-      cend[iSL] = new HC_CC_Circle(*end_left_backward);
-      qi1[iSL] = new Configuration(*qb);
-      length[iSL] = configuration_distance(start, *qb) + end_left_backward->cc_turn_length(*qb);
+      candidate.reset(iSL);
+      *candidate.cend_slot() = end_left_backward;
+      *candidate.qi1_slot() = qb;
+      candidate.length = configuration_distance(start, qb) + end_left_backward.cc_turn_length(qb);
     }
     // case RSL
     else
     {
-      cstart[RSL] = new HC_CC_Circle(*start_right_forward);
-      cend[RSL] = new HC_CC_Circle(*end_left_backward);
-      qi1[RSL] = new Configuration(*qa);
-      qi2[RSL] = new Configuration(*qb);
-      length[RSL] = start_right_forward->cc_turn_length(*qa) + configuration_distance(*qa, *qb) +
-                    end_left_backward->cc_turn_length(*qb);
+      candidate.reset(RSL);
+      *candidate.cstart_slot() = start_right_forward;
+      *candidate.cend_slot() = end_left_backward;
+      *candidate.qi1_slot() = qa;
+      *candidate.qi2_slot() = qb;
+      candidate.length = start_right_forward.cc_turn_length(qa) + configuration_distance(qa, qb) +
+                         end_left_backward.cc_turn_length(qb);
     }
-    delete qa;
-    delete qb;
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_RSL);
   // case RSR and subcases ReS, eSR
-  if (cc_dubins::external_mu_tangent_exists(*start_right_forward, *end_right_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_RSR);
+  if (cc_dubins::external_mu_tangent_exists(start_right_forward, end_right_backward))
   {
-    Configuration *qa, *qb;
-    cc_dubins::external_mu_tangent(*start_right_forward, *end_right_backward, &qa, &qb);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_RSR);
+    Configuration qa, qb;
+    cc_dubins::external_mu_tangent(start_right_forward, end_right_backward, &qa, &qb);
     // subcase ReS
-    if (configuration_aligned(*qb, end))
+    if (configuration_aligned(qb, end))
     {
-      cstart[ReS] = new HC_CC_Circle(*start_right_forward);
-      qi1[ReS] = new Configuration(*qa);
-      length[ReS] = start_right_forward->cc_turn_length(*qa) + configuration_distance(*qa, end);
+      candidate.reset(ReS);
+      *candidate.cstart_slot() = start_right_forward;
+      *candidate.qi1_slot() = qa;
+      candidate.length = start_right_forward.cc_turn_length(qa) + configuration_distance(qa, end);
     }
     // subcase eSR
-    else if (configuration_aligned(start, *qa))
+    else if (configuration_aligned(start, qa))
     {
-      cend[eSR] = new HC_CC_Circle(*end_right_backward);
-      qi1[eSR] = new Configuration(*qb);
-      length[eSR] = configuration_distance(start, *qb) + end_right_backward->cc_turn_length(*qb);
+      candidate.reset(eSR);
+      *candidate.cend_slot() = end_right_backward;
+      *candidate.qi1_slot() = qb;
+      candidate.length = configuration_distance(start, qb) + end_right_backward.cc_turn_length(qb);
     }
     // case RSR
     else
     {
-      cstart[RSR] = new HC_CC_Circle(*start_right_forward);
-      cend[RSR] = new HC_CC_Circle(*end_right_backward);
-      qi1[RSR] = new Configuration(*qa);
-      qi2[RSR] = new Configuration(*qb);
-      length[RSR] = start_right_forward->cc_turn_length(*qa) + configuration_distance(*qa, *qb) +
-                    end_right_backward->cc_turn_length(*qb);
+      candidate.reset(RSR);
+      *candidate.cstart_slot() = start_right_forward;
+      *candidate.cend_slot() = end_right_backward;
+      *candidate.qi1_slot() = qa;
+      *candidate.qi2_slot() = qb;
+      candidate.length = start_right_forward.cc_turn_length(qa) + configuration_distance(qa, qb) +
+                         end_right_backward.cc_turn_length(qb);
     }
-    delete qa;
-    delete qb;
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_RSR);
   // case LRL
-  if (cc_dubins::tangent_circle_exists(*start_left_forward, *end_left_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_LRL);
+  if (cc_dubins::tangent_circle_exists(start_left_forward, end_left_backward))
   {
-    HC_CC_Circle *middle_right_forward = nullptr;
-    cc_dubins::tangent_circle(*start_left_forward, *end_left_backward, &qi1[LR1L], &qi2[LR1L], &qi1[LR2L], &qi2[LR2L]);
-    cstart[LR1L] = new HC_CC_Circle(*start_left_forward);
-    cend[LR1L] = new HC_CC_Circle(*end_left_backward);
-    middle_right_forward = new HC_CC_Circle(*qi1[LR1L], false, true, true, hc_cc_circle_param_);
-    ci1[LR1L] = middle_right_forward;
-    length[LR1L] = start_left_forward->cc_turn_length(*qi1[LR1L]) + middle_right_forward->cc_turn_length(*qi2[LR1L]) +
-                   end_left_backward->cc_turn_length(*qi2[LR1L]);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_LRL);
+    Configuration qa, qb, qc, qd;
+    cc_dubins::tangent_circle(start_left_forward, end_left_backward, &qa, &qb, &qc, &qd);
+    candidate.reset(LR1L);
+    *candidate.cstart_slot() = start_left_forward;
+    *candidate.cend_slot() = end_left_backward;
+    *candidate.qi1_slot() = qa;
+    *candidate.qi2_slot() = qb;
+    *candidate.ci1_slot() = HC_CC_Circle(qa, false, true, true, hc_cc_circle_param_);
+    candidate.length = start_left_forward.cc_turn_length(qa) + candidate.ci1.cc_turn_length(qb) +
+                       end_left_backward.cc_turn_length(qb);
+    path->assign_if_shorter(candidate);
 
-    cstart[LR2L] = new HC_CC_Circle(*start_left_forward);
-    cend[LR2L] = new HC_CC_Circle(*end_left_backward);
-    middle_right_forward = new HC_CC_Circle(*qi1[LR2L], false, true, true, hc_cc_circle_param_);
-    ci1[LR2L] = middle_right_forward;
-    length[LR2L] = start_left_forward->cc_turn_length(*qi1[LR2L]) + middle_right_forward->cc_turn_length(*qi2[LR2L]) +
-                   end_left_backward->cc_turn_length(*qi2[LR2L]);
+    candidate.reset(LR2L);
+    *candidate.cstart_slot() = start_left_forward;
+    *candidate.cend_slot() = end_left_backward;
+    *candidate.qi1_slot() = qc;
+    *candidate.qi2_slot() = qd;
+    *candidate.ci1_slot() = HC_CC_Circle(qc, false, true, true, hc_cc_circle_param_);
+    candidate.length = start_left_forward.cc_turn_length(qc) + candidate.ci1.cc_turn_length(qd) +
+                       end_left_backward.cc_turn_length(qd);
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_LRL);
   // case RLR
-  if (cc_dubins::tangent_circle_exists(*start_right_forward, *end_right_backward))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_DUBINS, CC_DUBINS_RLR);
+  if (cc_dubins::tangent_circle_exists(start_right_forward, end_right_backward))
   {
-    HC_CC_Circle *middle_left_forward = nullptr;
-    cc_dubins::tangent_circle(*start_right_forward, *end_right_backward, &qi1[RL1R], &qi2[RL1R], &qi1[RL2R],
-                              &qi2[RL2R]);
-    cstart[RL1R] = new HC_CC_Circle(*start_right_forward);
-    cend[RL1R] = new HC_CC_Circle(*end_right_backward);
-    middle_left_forward = new HC_CC_Circle(*qi1[RL1R], true, true, true, hc_cc_circle_param_);
-    ci1[RL1R] = middle_left_forward;
-    length[RL1R] = start_right_forward->cc_turn_length(*qi1[RL1R]) + middle_left_forward->cc_turn_length(*qi2[RL1R]) +
-                   end_right_backward->cc_turn_length(*qi2[RL1R]);
+    INSTRUMENTATION_FAMILY_HIT(CC_DUBINS_RLR);
+    Configuration qa, qb, qc, qd;
+    cc_dubins::tangent_circle(start_right_forward, end_right_backward, &qa, &qb, &qc, &qd);
+    candidate.reset(RL1R);
+    *candidate.cstart_slot() = start_right_forward;
+    *candidate.cend_slot() = end_right_backward;
+    *candidate.qi1_slot() = qa;
+    *candidate.qi2_slot() = qb;
+    *candidate.ci1_slot() = HC_CC_Circle(qa, true, true, true, hc_cc_circle_param_);
+    candidate.length = start_right_forward.cc_turn_length(qa) + candidate.ci1.cc_turn_length(qb) +
+                       end_right_backward.cc_turn_length(qb);
+    path->assign_if_shorter(candidate);
 
-    cstart[RL2R] = new HC_CC_Circle(*start_right_forward);
-    cend[RL2R] = new HC_CC_Circle(*end_right_backward);
-    middle_left_forward = new HC_CC_Circle(*qi1[RL2R], true, true, true, hc_cc_circle_param_);
-    ci1[RL2R] = middle_left_forward;
-    length[RL2R] = start_right_forward->cc_turn_length(*qi1[RL2R]) + middle_left_forward->cc_turn_length(*qi2[RL2R]) +
-                   end_right_backward->cc_turn_length(*qi2[RL2R]);
+    candidate.reset(RL2R);
+    *candidate.cstart_slot() = start_right_forward;
+    *candidate.cend_slot() = end_right_backward;
+    *candidate.qi1_slot() = qc;
+    *candidate.qi2_slot() = qd;
+    *candidate.ci1_slot() = HC_CC_Circle(qc, true, true, true, hc_cc_circle_param_);
+    candidate.length = start_right_forward.cc_turn_length(qc) + candidate.ci1.cc_turn_length(qd) +
+                       end_right_backward.cc_turn_length(qd);
+    path->assign_if_shorter(candidate);
   }
-label_end:
-  // select shortest path
-  cc_dubins_path_type best_path = (cc_dubins_path_type)array_index_min(length, nb_cc_dubins_paths);
-  CC_Dubins_Path *path;
-  path = new CC_Dubins_Path(start, end, best_path, kappa_, sigma_, qi1[best_path], qi2[best_path], cstart[best_path],
-                            cend[best_path], ci1[best_path], length[best_path]);
+  INSTRUMENTATION_FAMILY_END(CC_DUBINS_RLR);
+  INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_DUBINS, cc_dubins::family(path->type));
+}
 
-  //  // display calculations
-  //  cout << endl << "CC_Dubins_State_Space" << endl;
-  //  for (int i = 0; i < nb_cc_dubins_paths; i++)
-  //  {
-  //    cout << i << ": ";
-  //    if (qi1[i])
-  //    {
-  //      qi1[i]->print(false);
-  //    }
-  //    cout << ", ";
-  //    if (qi2[i])
-  //    {
-  //      qi2[i]->print(false);
-  //    }
-  //    cout << ", " << length[i] << endl;
-  //  }
-  //  cout << "shortest path: " << (int)best_path << endl;
-  //  path->print(true);
+void CC_Dubins_State_Space::cc_dubins(const State &state1, const State &state2, CC_Dubins_Path_Candidate *path) const
+{
+  HC_CC_Circle start_circle[2], end_circle[2];
+  cc_dubins_start_circles(state1, start_circle);
+  cc_dubins_end_circles(state2, end_circle);
+  cc_dubins(state1, start_circle, state2, end_circle, path);
+}
 
-  // clean up
-  delete start_left_forward;
-  delete start_right_forward;
-  delete end_left_backward;
-  delete end_right_backward;
-  for (int i = 0; i < nb_cc_dubins_paths; i++)
-  {
-    if (i != best_path)
-    {
-      delete qi1[i];
-      delete qi2[i];
-      delete cstart[i];
-      delete ci1[i];
-      delete cend[i];
-    }
-  }
-  return path;
+CC_Dubins_Path *CC_Dubins_State_Space::cc_dubins(const State &state1, const State &state2) const
+{
+  CC_Dubins_Path_Candidate path;
+  cc_dubins(state1, state2, &path);
+  return path.materialize(kappa_, sigma_);
 }
 
 double CC_Dubins_State_Space::get_distance(const State &state1, const State &state2) const
 {
-  CC_Dubins_Path *p;
+  CC_Dubins_Path_Candidate p;
   if (forwards_)
-    p = this->cc_dubins(state1, state2);
+    this->cc_dubins(state1, state2, &p);
   else
-    p = this->cc_dubins(state2, state1);
-  double length = p->length;
-  delete p;
-  return length;
+    this->cc_dubins(state2, state1, &p);
+  return p.length;
+}
+
+void CC_Dubins_State_Space::get_distances(const State &state1, const State *states2, size_t n,
+                                          double *distances) const
+{
+  // state1 is the start configuration when driving forwards and the end configuration otherwise
+  HC_CC_Circle circle1[2], circle2[2];
+  CC_Dubins_Path_Candidate p;
+  if (forwards_)
+  {
+    cc_dubins_start_circles(state1, circle1);
+    for (size_t i = 0; i < n; i++)
+    {
+      cc_dubins_end_circles(states2[i], circle2);
+      this->cc_dubins(state1, circle1, states2[i], circle2, &p);
+      distances[i] = p.length;
+    }
+  }
+  else
+  {
+    cc_dubins_end_circles(state1, circle1);
+    for (size_t i = 0; i < n; i++)
+    {
+      cc_dubins_start_circles(states2[i], circle2);
+      this->cc_dubins(states2[i], circle2, state1, circle1, &p);
+      distances[i] = p.length;
+    }
+  }
 }
 
 vector<Control> CC_Dubins_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> cc_dubins_controls;
   cc_dubins_controls.reserve(3);
-  CC_Dubins_Path *p;
+  CC_Dubins_Path_Candidate p;
   if (forwards_)
-    p = this->cc_dubins(state1, state2);
+    this->cc_dubins(state1, state2, &p);
   else
-    p = this->cc_dubins(state2, state1);
-  switch (p->type)
+    this->cc_dubins(state2, state1, &p);
+  switch (p.type)
   {
     case E:
       break;
     case S:
-      straight_controls(p->start, p->end, cc_dubins_controls);
+      straight_controls(p.start, p.end, cc_dubins_controls);
       break;
     case R:
     case L:
-      cc_turn_controls(*(p->cstart), p->end, true, cc_dubins_controls);
+      cc_turn_controls(p.cstart, p.end, true, cc_dubins_controls);
       break;
     case eSL:
     case iSL:
     case eSR:
     case iSR:
-      straight_controls(p->start, *(p->qi1), cc_dubins_controls);
-      cc_turn_controls(*(p->cend), *(p->qi1), false, cc_dubins_controls);
+      straight_controls(p.start, p.qi1, cc_dubins_controls);
+      cc_turn_controls(p.cend, p.qi1, false, cc_dubins_controls);
       break;
     case ReS:
     case RiS:
     case LeS:
     case LiS:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_dubins_controls);
-      straight_controls(*(p->qi1), p->end, cc_dubins_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_dubins_controls);
+      straight_controls(p.qi1, p.end, cc_dubins_controls);
       break;
     case LSL:
     case LSR:
     case RSL:
     case RSR:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_dubins_controls);
-      straight_controls(*(p->qi1), *(p->qi2), cc_dubins_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_dubins_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_dubins_controls);
+      straight_controls(p.qi1, p.qi2, cc_dubins_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_dubins_controls);
       break;
     case LR1L:
     case LR2L:
     case RL1R:
     case RL2R:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_dubins_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_dubins_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_dubins_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_dubins_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_dubins_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_dubins_controls);
       break;
     default:
       break;
@@ -523,6 +609,5 @@ vector<Control> CC_Dubins_State_Space::get_controls(const State &state1, const S
       control.sigma = -control.sigma;
     }
   }
-  delete p;
   return cc_dubins_controls;
 }
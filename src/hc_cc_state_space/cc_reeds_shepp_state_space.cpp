@@ -24,16 +24,17 @@
 **********************************************************************/
 
 #include "steering_functions/hc_cc_state_space/cc_reeds_shepp_state_space.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 
 #define CC_REGULAR false
 
 class CC_Reeds_Shepp_State_Space::CC_Reeds_Shepp
 {
 private:
-  CC_Reeds_Shepp_State_Space *parent_;
+  const CC_Reeds_Shepp_State_Space *parent_;
 
 public:
-  explicit CC_Reeds_Shepp(CC_Reeds_Shepp_State_Space *parent)
+  explicit CC_Reeds_Shepp(const CC_Reeds_Shepp_State_Space *parent)
   {
     parent_ = parent;
   }
@@ -55,7 +56,7 @@ public:
     return fabs(distance - 2 * c1.radius) < get_epsilon();
   }
 
-  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q)
+  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q)
   {
     double x = (c1.xc + c2.xc) / 2;
     double y = (c1.yc + c2.yc) / 2;
@@ -83,8 +84,8 @@ public:
         theta = angle - HALF_PI - c1.mu;
       }
     }
-    *q = new Configuration(x, y, theta, 0);
-    return c1.cc_turn_length(**q) + c2.cc_turn_length(**q);
+    *q = Configuration(x, y, theta, 0);
+    return c1.cc_turn_length(*q) + c2.cc_turn_length(*q);
   }
 
   // ##### TcT ##################################################################
@@ -101,7 +102,7 @@ public:
     return fabs(distance - 2 * c1.radius * c1.cos_mu) < get_epsilon();
   }
 
-  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q)
+  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q)
   {
     double distance = center_distance(c1, c2);
     double delta_x = 0.5 * distance;
@@ -134,8 +135,8 @@ public:
         global_frame_change(c1.xc, c1.yc, angle, delta_x, delta_y, &x, &y);
       }
     }
-    *q = new Configuration(x, y, theta, 0);
-    return c1.cc_turn_length(**q) + c2.cc_turn_length(**q);
+    *q = Configuration(x, y, theta, 0);
+    return c1.cc_turn_length(*q) + c2.cc_turn_length(*q);
   }
 
   // ##### Reeds-Shepp families: ################################################
@@ -154,8 +155,8 @@ public:
     return distance <= 4 * c1.radius * c1.cos_mu;
   }
 
-  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4)
+  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = 2 * c1.radius * c1.cos_mu;
@@ -174,26 +175,22 @@ public:
     TcT_path(tgt2, c2, q4);
   }
 
-  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                    HC_CC_Circle **ci)
+  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                    HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
-    double length1 = c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + c2.cc_turn_length(*qb);
-    double length2 = c1.cc_turn_length(*qc) + middle2->cc_turn_length(*qd) + c2.cc_turn_length(*qd);
+    double length1 = c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + c2.cc_turn_length(qb);
+    double length2 = c1.cc_turn_length(qc) + middle2.cc_turn_length(qd) + c2.cc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -201,9 +198,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -223,8 +217,8 @@ public:
     return (distance <= 2 * c1.radius * (1 + c1.cos_mu)) && (distance >= 2 * c1.radius * (1 - c1.cos_mu));
   }
 
-  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 * c1.radius * c1.cos_mu;
@@ -244,26 +238,22 @@ public:
     TT_path(tgt2, c2, q4);
   }
 
-  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                   HC_CC_Circle **ci)
+  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                   HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
-    double length1 = c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + c2.cc_turn_length(*qb);
-    double length2 = c1.cc_turn_length(*qc) + middle2->cc_turn_length(*qd) + c2.cc_turn_length(*qd);
+    double length1 = c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + c2.cc_turn_length(qb);
+    double length2 = c1.cc_turn_length(qc) + middle2.cc_turn_length(qd) + c2.cc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -271,9 +261,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -293,8 +280,8 @@ public:
     return (distance <= 2 * c1.radius * (1 + c1.cos_mu)) && (distance >= 2 * c1.radius * (1 - c1.cos_mu));
   }
 
-  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 * c1.radius;
@@ -314,26 +301,22 @@ public:
     TcT_path(tgt2, c2, q4);
   }
 
-  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                   HC_CC_Circle **ci)
+  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                   HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
-    double length1 = c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + c2.cc_turn_length(*qb);
-    double length2 = c1.cc_turn_length(*qc) + middle2->cc_turn_length(*qd) + c2.cc_turn_length(*qd);
+    double length1 = c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + c2.cc_turn_length(qb);
+    double length2 = c1.cc_turn_length(qc) + middle2.cc_turn_length(qd) + c2.cc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -341,9 +324,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -382,7 +362,7 @@ public:
     return TiST_exists(c1, c2) || TeST_exists(c1, c2);
   }
 
-  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double distance = center_distance(c1, c2);
     double angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
@@ -394,38 +374,38 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double delta_x = fabs(c1.radius * c1.sin_mu);
     double delta_y = fabs(c1.radius * c1.cos_mu);
@@ -434,35 +414,35 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     if (TiST_exists(c1, c2))
     {
@@ -507,8 +487,8 @@ public:
     return TiSTcT_exists(c1, c2) || TeSTcT_exists(c1, c2);
   }
 
-  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                     Configuration **q3, HC_CC_Circle **ci)
+  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                     Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double r = c2.radius * c2.cos_mu;
@@ -522,14 +502,14 @@ public:
     TiST_path(c1, tgt1, q1, q2);
     TcT_path(tgt1, c2, q3);
 
-    *ci = new HC_CC_Circle(**q2, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q2, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + (*ci)->cc_turn_length(**q3) +
-           c2.cc_turn_length(**q3);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + ci->cc_turn_length(*q3) +
+           c2.cc_turn_length(*q3);
   }
 
-  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                     Configuration **q3, HC_CC_Circle **ci)
+  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                     Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 * c2.radius * c2.cos_mu;
@@ -542,14 +522,14 @@ public:
     TeST_path(c1, tgt1, q1, q2);
     TcT_path(tgt1, c2, q3);
 
-    *ci = new HC_CC_Circle(**q2, c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q2, c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + (*ci)->cc_turn_length(**q3) +
-           c2.cc_turn_length(**q3);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + ci->cc_turn_length(*q3) +
+           c2.cc_turn_length(*q3);
   }
 
-  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                    Configuration **q3, HC_CC_Circle **ci)
+  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                    Configuration *q3, HC_CC_Circle *ci)
   {
     if (TiSTcT_exists(c1, c2))
     {
@@ -594,8 +574,8 @@ public:
     return TcTiST_exists(c1, c2) || TcTeST_exists(c1, c2);
   }
 
-  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                     Configuration **q3, HC_CC_Circle **ci)
+  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                     Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double r = c1.radius * c1.cos_mu;
@@ -609,14 +589,14 @@ public:
     TcT_path(c1, tgt1, q1);
     TiST_path(tgt1, c2, q2, q3);
 
-    *ci = new HC_CC_Circle(**q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + (*ci)->cc_turn_length(**q2) + configuration_distance(**q2, **q3) +
-           c2.cc_turn_length(**q3);
+    return c1.cc_turn_length(*q1) + ci->cc_turn_length(*q2) + configuration_distance(*q2, *q3) +
+           c2.cc_turn_length(*q3);
   }
 
-  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                     Configuration **q3, HC_CC_Circle **ci)
+  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                     Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 * c2.radius * c2.cos_mu;
@@ -629,14 +609,14 @@ public:
     TcT_path(c1, tgt1, q1);
     TeST_path(tgt1, c2, q2, q3);
 
-    *ci = new HC_CC_Circle(**q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + (*ci)->cc_turn_length(**q2) + configuration_distance(**q2, **q3) +
-           c2.cc_turn_length(**q3);
+    return c1.cc_turn_length(*q1) + ci->cc_turn_length(*q2) + configuration_distance(*q2, *q3) +
+           c2.cc_turn_length(*q3);
   }
 
-  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                    Configuration **q3, HC_CC_Circle **ci)
+  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                    Configuration *q3, HC_CC_Circle *ci)
   {
     if (TcTiST_exists(c1, c2))
     {
@@ -681,8 +661,8 @@ public:
     return TcTiSTcT_exists(c1, c2) || TcTeSTcT_exists(c1, c2);
   }
 
-  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                       Configuration **q3, Configuration **q4, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                       Configuration *q3, Configuration *q4, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double r = c1.radius * c1.cos_mu;
@@ -699,15 +679,15 @@ public:
     TiST_path(tgt1, tgt2, q2, q3);
     TcT_path(tgt2, c2, q4);
 
-    *ci1 = new HC_CC_Circle(**q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, c2.regular, parent_->hc_cc_circle_param_);
+    *ci1 = HC_CC_Circle(*q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, c2.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + (*ci1)->cc_turn_length(**q2) + configuration_distance(**q2, **q3) +
-           (*ci2)->cc_turn_length(**q4) + c2.cc_turn_length(**q4);
+    return c1.cc_turn_length(*q1) + ci1->cc_turn_length(*q2) + configuration_distance(*q2, *q3) +
+           ci2->cc_turn_length(*q4) + c2.cc_turn_length(*q4);
   }
 
-  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                       Configuration **q3, Configuration **q4, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                       Configuration *q3, Configuration *q4, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double delta_x = 2 * c1.radius * c1.cos_mu;
@@ -723,15 +703,15 @@ public:
     TeST_path(tgt1, tgt2, q2, q3);
     TcT_path(tgt2, c2, q4);
 
-    *ci1 = new HC_CC_Circle(**q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, c2.regular, parent_->hc_cc_circle_param_);
+    *ci1 = HC_CC_Circle(*q1, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, c2.regular, parent_->hc_cc_circle_param_);
 
-    return c1.cc_turn_length(**q1) + (*ci1)->cc_turn_length(**q2) + configuration_distance(**q2, **q3) +
-           (*ci2)->cc_turn_length(**q4) + c2.cc_turn_length(**q4);
+    return c1.cc_turn_length(*q1) + ci1->cc_turn_length(*q2) + configuration_distance(*q2, *q3) +
+           ci2->cc_turn_length(*q4) + c2.cc_turn_length(*q4);
   }
 
-  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                      Configuration **q3, Configuration **q4, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                      Configuration *q3, Configuration *q4, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     if (TcTiSTcT_exists(c1, c2))
     {
@@ -758,8 +738,8 @@ public:
     return (distance <= 2 * c1.radius * (c1.cos_mu + 2));
   }
 
-  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1, r2, delta_x, delta_y, x, y;
@@ -795,22 +775,21 @@ public:
     TT_path(tgt4, c2, q6);
   }
 
-  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                    Configuration **q3, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                    Configuration *q3, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TTcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *middle1, *middle2, *middle3, *middle4;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qb, !c2.left, !c2.forward, c2.regular, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qd, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qe, !c2.left, !c2.forward, c2.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qb, !c2.left, !c2.forward, c2.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qd, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qe, !c2.left, !c2.forward, c2.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
     double length1 =
-        c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + middle2->cc_turn_length(*qc) + c2.cc_turn_length(*qc);
+        c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + middle2.cc_turn_length(qc) + c2.cc_turn_length(qc);
     double length2 =
-        c1.cc_turn_length(*qd) + middle3->cc_turn_length(*qe) + middle4->cc_turn_length(*qf) + c2.cc_turn_length(*qf);
+        c1.cc_turn_length(qd) + middle3.cc_turn_length(qe) + middle4.cc_turn_length(qf) + c2.cc_turn_length(qf);
     if (length1 < length2)
     {
       *q1 = qa;
@@ -818,11 +797,6 @@ public:
       *q3 = qc;
       *ci1 = middle1;
       *ci2 = middle2;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -832,11 +806,6 @@ public:
       *q3 = qf;
       *ci1 = middle3;
       *ci2 = middle4;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete middle1;
-      delete middle2;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -856,8 +825,8 @@ public:
     return (distance <= 2 * c1.radius * (2 * c1.cos_mu + 1)) && (distance >= 2 * c1.radius * (2 * c1.cos_mu - 1));
   }
 
-  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                              Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                              Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1 = 2 * c1.radius * c1.cos_mu;
@@ -885,22 +854,21 @@ public:
     TcT_path(tgt4, c2, q6);
   }
 
-  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                     Configuration **q3, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                     Configuration *q3, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TcTTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *middle1, *middle2, *middle3, *middle4;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qb, c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qd, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qe, c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qb, c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qd, !c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qe, c1.left, !c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
     double length1 =
-        c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + middle2->cc_turn_length(*qc) + c2.cc_turn_length(*qc);
+        c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + middle2.cc_turn_length(qc) + c2.cc_turn_length(qc);
     double length2 =
-        c1.cc_turn_length(*qd) + middle3->cc_turn_length(*qe) + middle4->cc_turn_length(*qf) + c2.cc_turn_length(*qf);
+        c1.cc_turn_length(qd) + middle3.cc_turn_length(qe) + middle4.cc_turn_length(qf) + c2.cc_turn_length(qf);
     if (length1 < length2)
     {
       *q1 = qa;
@@ -908,11 +876,6 @@ public:
       *q3 = qc;
       *ci1 = middle1;
       *ci2 = middle2;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -922,11 +885,6 @@ public:
       *q3 = qf;
       *ci1 = middle3;
       *ci2 = middle4;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete middle1;
-      delete middle2;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -948,8 +906,8 @@ public:
     return distance <= 4 * c1.radius;
   }
 
-  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                           Configuration **q3, Configuration **q4)
+  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                           Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = 2 * c1.radius;
@@ -968,26 +926,22 @@ public:
     TT_path(tgt2, c2, q4);
   }
 
-  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                  HC_CC_Circle **ci)
+  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                  HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, c1.regular, parent_->hc_cc_circle_param_);
 
     // select shortest connection
-    double length1 = c1.cc_turn_length(*qa) + middle1->cc_turn_length(*qb) + c2.cc_turn_length(*qb);
-    double length2 = c1.cc_turn_length(*qc) + middle2->cc_turn_length(*qd) + c2.cc_turn_length(*qd);
+    double length1 = c1.cc_turn_length(qa) + middle1.cc_turn_length(qb) + c2.cc_turn_length(qb);
+    double length2 = c1.cc_turn_length(qc) + middle2.cc_turn_length(qd) + c2.cc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -995,9 +949,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -1035,7 +986,7 @@ public:
     return TciST_exists(c1, c2) || TceST_exists(c1, c2);
   }
 
-  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double alpha = fabs(asin(2 * c1.radius * c1.cos_mu / distance));
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1045,38 +996,38 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double theta = angle;
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1085,35 +1036,35 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     if (TciST_exists(c1, c2))
     {
@@ -1158,7 +1109,7 @@ public:
     return TiScT_exists(c1, c2) || TeScT_exists(c1, c2);
   }
 
-  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double alpha = fabs(asin(2 * c1.radius * c1.cos_mu / distance));
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1168,38 +1119,38 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double theta = angle;
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1208,35 +1159,35 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     if (TiScT_exists(c1, c2))
     {
@@ -1281,7 +1232,7 @@ public:
     return TciScT_exists(c1, c2) || TceScT_exists(c1, c2);
   }
 
-  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double alpha = fabs(asin(2 * c1.radius * c1.cos_mu / distance));
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1291,38 +1242,38 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     double theta = angle;
     double delta_x = fabs(c1.radius * c1.sin_mu);
@@ -1331,35 +1282,35 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, 0);
+      *q1 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, 0);
+      *q1 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
     }
-    return c1.cc_turn_length(**q1) + configuration_distance(**q1, **q2) + c2.cc_turn_length(**q2);
+    return c1.cc_turn_length(*q1) + configuration_distance(*q1, *q2) + c2.cc_turn_length(*q2);
   }
 
-  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2)
+  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2)
   {
     if (TciScT_exists(c1, c2))
     {
@@ -1377,358 +1328,407 @@ public:
 
 CC_Reeds_Shepp_State_Space::CC_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization)
   : HC_CC_State_Space(kappa, sigma, discretization)
-  , cc_reeds_shepp_{ unique_ptr<CC_Reeds_Shepp>(new CC_Reeds_Shepp(this)) }
 {
 }
 
 CC_Reeds_Shepp_State_Space::~CC_Reeds_Shepp_State_Space() = default;
 
-HC_CC_RS_Path *CC_Reeds_Shepp_State_Space::cc_circles_rs_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2) const
+void CC_Reeds_Shepp_State_Space::cc_circles_rs_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2,
+                                                    HC_CC_RS_Path_Candidate *path) const
 {
-  // table containing the lengths of the paths, the intermediate configurations and circles
-  double length[nb_hc_cc_rs_paths];
-  double_array_init(length, nb_hc_cc_rs_paths, numeric_limits<double>::max());
-  Configuration *qi1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi1, nb_hc_cc_rs_paths);
-  Configuration *qi2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi2, nb_hc_cc_rs_paths);
-  Configuration *qi3[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi3, nb_hc_cc_rs_paths);
-  Configuration *qi4[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi4, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cstart[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cstart, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci1, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci2, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cend[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cend, nb_hc_cc_rs_paths);
+  // slot of the family under evaluation, the shortest family is kept in path
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
+
+  // families and precomputations of this query, a per-call instance keeps the state space reentrant
+  CC_Reeds_Shepp families(this);
 
   // precomputations
-  cc_reeds_shepp_->distance = center_distance(c1, c2);
-  cc_reeds_shepp_->angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
+  families.distance = center_distance(c1, c2);
+  families.angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
 
   // case Empty
   if (configuration_equal(c1.start, c2.start))
   {
-    length[EMPTY] = 0;
-    goto label_end;
+    path->length = 0;
+    return;
   }
   // case Straight forwards
   if (configuration_aligned(c1.start, c2.start))
   {
-    length[STRAIGHT] = configuration_distance(c1.start, c2.start);
-    goto label_end;
+    path->reset(STRAIGHT);
+    path->length = configuration_distance(c1.start, c2.start);
+    return;
   }
   // case Straight backwards
   if (configuration_aligned(c2.start, c1.start))
   {
-    length[STRAIGHT] = configuration_distance(c2.start, c1.start);
-    goto label_end;
+    path->reset(STRAIGHT);
+    path->length = configuration_distance(c2.start, c1.start);
+    return;
   }
   // case T
   if (configuration_on_hc_cc_circle(c1, c2.start))
   {
-    cstart[T] = new HC_CC_Circle(c1);
-    length[T] = cstart[T]->cc_turn_length(c2.start);
-    goto label_end;
+    path->reset(T);
+    *path->cstart_slot() = HC_CC_Circle(c1);
+    path->length = path->cstart.cc_turn_length(c2.start);
+    return;
   }
   // case TT
-  if (cc_reeds_shepp_->TT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TT);
+  if (families.TT_exists(c1, c2))
   {
-    cstart[TT] = new HC_CC_Circle(c1);
-    cend[TT] = new HC_CC_Circle(c2);
-    length[TT] = cc_reeds_shepp_->TT_path(*cstart[TT], *cend[TT], &qi1[TT]);
+    INSTRUMENTATION_FAMILY_HIT(TT);
+    candidate.reset(TT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TT_path(candidate.cstart, candidate.cend, candidate.qi1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TT);
   // case TcT
-  if (cc_reeds_shepp_->TcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcT);
+  if (families.TcT_exists(c1, c2))
   {
-    cstart[TcT] = new HC_CC_Circle(c1);
-    cend[TcT] = new HC_CC_Circle(c2);
-    length[TcT] = cc_reeds_shepp_->TcT_path(*cstart[TcT], *cend[TcT], &qi1[TcT]);
+    INSTRUMENTATION_FAMILY_HIT(TcT);
+    candidate.reset(TcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcT);
   // ##### Reeds-Shepp families: ############################################
   // case TcTcT
-  if (cc_reeds_shepp_->TcTcT_exists(c1, c2))
-  {
-    cstart[TcTcT] = new HC_CC_Circle(c1);
-    cend[TcTcT] = new HC_CC_Circle(c2);
-    length[TcTcT] = cc_reeds_shepp_->TcTcT_path(*cstart[TcTcT], *cend[TcTcT], &qi1[TcTcT], &qi2[TcTcT], &ci1[TcTcT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcTcT);
+  if (families.TcTcT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcTcT);
+    candidate.reset(TcTcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcTcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                           candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcTcT);
   // case TcTT
-  if (cc_reeds_shepp_->TcTT_exists(c1, c2))
-  {
-    cstart[TcTT] = new HC_CC_Circle(c1);
-    cend[TcTT] = new HC_CC_Circle(c2);
-    length[TcTT] = cc_reeds_shepp_->TcTT_path(*cstart[TcTT], *cend[TcTT], &qi1[TcTT], &qi2[TcTT], &ci1[TcTT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcTT);
+  if (families.TcTT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcTT);
+    candidate.reset(TcTT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcTT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                          candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcTT);
   // case TTcT
-  if (cc_reeds_shepp_->TTcT_exists(c1, c2))
-  {
-    cstart[TTcT] = new HC_CC_Circle(c1);
-    cend[TTcT] = new HC_CC_Circle(c2);
-    length[TTcT] = cc_reeds_shepp_->TTcT_path(*cstart[TTcT], *cend[TTcT], &qi1[TTcT], &qi2[TTcT], &ci1[TTcT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TTcT);
+  if (families.TTcT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TTcT);
+    candidate.reset(TTcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TTcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                          candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TTcT);
   // case TST
-  if (cc_reeds_shepp_->TST_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TST);
+  if (families.TST_exists(c1, c2))
   {
-    cstart[TST] = new HC_CC_Circle(c1);
-    cend[TST] = new HC_CC_Circle(c2);
-    length[TST] = cc_reeds_shepp_->TST_path(*cstart[TST], *cend[TST], &qi1[TST], &qi2[TST]);
+    INSTRUMENTATION_FAMILY_HIT(TST);
+    candidate.reset(TST);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TST_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TST);
   // case TSTcT
-  if (cc_reeds_shepp_->TSTcT_exists(c1, c2))
-  {
-    cstart[TSTcT] = new HC_CC_Circle(c1);
-    cend[TSTcT] = new HC_CC_Circle(c2);
-    length[TSTcT] =
-        cc_reeds_shepp_->TSTcT_path(*cstart[TSTcT], *cend[TSTcT], &qi1[TSTcT], &qi2[TSTcT], &qi3[TSTcT], &ci1[TSTcT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TSTcT);
+  if (families.TSTcT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TSTcT);
+    candidate.reset(TSTcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TSTcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                           candidate.qi3_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TSTcT);
   // case TcTST
-  if (cc_reeds_shepp_->TcTST_exists(c1, c2))
-  {
-    cstart[TcTST] = new HC_CC_Circle(c1);
-    cend[TcTST] = new HC_CC_Circle(c2);
-    length[TcTST] =
-        cc_reeds_shepp_->TcTST_path(*cstart[TcTST], *cend[TcTST], &qi1[TcTST], &qi2[TcTST], &qi3[TcTST], &ci1[TcTST]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcTST);
+  if (families.TcTST_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcTST);
+    candidate.reset(TcTST);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcTST_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                           candidate.qi3_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcTST);
   // case TcTSTcT
-  if (cc_reeds_shepp_->TcTSTcT_exists(c1, c2))
-  {
-    cstart[TcTSTcT] = new HC_CC_Circle(c1);
-    cend[TcTSTcT] = new HC_CC_Circle(c2);
-    length[TcTSTcT] = cc_reeds_shepp_->TcTSTcT_path(*cstart[TcTSTcT], *cend[TcTSTcT], &qi1[TcTSTcT], &qi2[TcTSTcT],
-                                                    &qi3[TcTSTcT], &qi4[TcTSTcT], &ci1[TcTSTcT], &ci2[TcTSTcT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcTSTcT);
+  if (families.TcTSTcT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcTSTcT);
+    candidate.reset(TcTSTcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcTSTcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(),
+                                             candidate.qi2_slot(), candidate.qi3_slot(), candidate.qi4_slot(),
+                                             candidate.ci1_slot(), candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcTSTcT);
   // case TTcTT
-  if (cc_reeds_shepp_->TTcTT_exists(c1, c2))
-  {
-    cstart[TTcTT] = new HC_CC_Circle(c1);
-    cend[TTcTT] = new HC_CC_Circle(c2);
-    length[TTcTT] = cc_reeds_shepp_->TTcTT_path(*cstart[TTcTT], *cend[TTcTT], &qi1[TTcTT], &qi2[TTcTT], &qi3[TTcTT],
-                                                &ci1[TTcTT], &ci2[TTcTT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TTcTT);
+  if (families.TTcTT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TTcTT);
+    candidate.reset(TTcTT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TTcTT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                           candidate.qi3_slot(), candidate.ci1_slot(), candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TTcTT);
   // case TcTTcT
-  if (cc_reeds_shepp_->TcTTcT_exists(c1, c2))
-  {
-    cstart[TcTTcT] = new HC_CC_Circle(c1);
-    cend[TcTTcT] = new HC_CC_Circle(c2);
-    length[TcTTcT] = cc_reeds_shepp_->TcTTcT_path(*cstart[TcTTcT], *cend[TcTTcT], &qi1[TcTTcT], &qi2[TcTTcT],
-                                                  &qi3[TcTTcT], &ci1[TcTTcT], &ci2[TcTTcT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcTTcT);
+  if (families.TcTTcT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcTTcT);
+    candidate.reset(TcTTcT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcTTcT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(),
+                                            candidate.qi2_slot(), candidate.qi3_slot(), candidate.ci1_slot(),
+                                            candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcTTcT);
   // ############################################################################
   // case TTT
-  if (cc_reeds_shepp_->TTT_exists(c1, c2))
-  {
-    cstart[TTT] = new HC_CC_Circle(c1);
-    cend[TTT] = new HC_CC_Circle(c2);
-    length[TTT] = cc_reeds_shepp_->TTT_path(*cstart[TTT], *cend[TTT], &qi1[TTT], &qi2[TTT], &ci1[TTT]);
-  }
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TTT);
+  if (families.TTT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TTT);
+    candidate.reset(TTT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TTT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot(),
+                                         candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TTT);
   // case TcST
-  if (cc_reeds_shepp_->TcST_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcST);
+  if (families.TcST_exists(c1, c2))
   {
-    cstart[TcST] = new HC_CC_Circle(c1);
-    cend[TcST] = new HC_CC_Circle(c2);
-    length[TcST] = cc_reeds_shepp_->TcST_path(*cstart[TcST], *cend[TcST], &qi1[TcST], &qi2[TcST]);
+    INSTRUMENTATION_FAMILY_HIT(TcST);
+    candidate.reset(TcST);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TcST_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcST);
   // case TScT
-  if (cc_reeds_shepp_->TScT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TScT);
+  if (families.TScT_exists(c1, c2))
   {
-    cstart[TScT] = new HC_CC_Circle(c1);
-    cend[TScT] = new HC_CC_Circle(c2);
-    length[TScT] = cc_reeds_shepp_->TScT_path(*cstart[TScT], *cend[TScT], &qi1[TScT], &qi2[TScT]);
+    INSTRUMENTATION_FAMILY_HIT(TScT);
+    candidate.reset(TScT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length = families.TScT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TScT);
   // case TcScT
-  if (cc_reeds_shepp_->TcScT_exists(c1, c2))
-  {
-    cstart[TcScT] = new HC_CC_Circle(c1);
-    cend[TcScT] = new HC_CC_Circle(c2);
-    length[TcScT] = cc_reeds_shepp_->TcScT_path(*cstart[TcScT], *cend[TcScT], &qi1[TcScT], &qi2[TcScT]);
-  }
-label_end:
-  // select shortest path
-  hc_cc_rs_path_type best_path = (hc_cc_rs_path_type)array_index_min(length, nb_hc_cc_rs_paths);
-  HC_CC_RS_Path *path;
-  path = new HC_CC_RS_Path(c1.start, c2.start, best_path, kappa_, sigma_, qi1[best_path], qi2[best_path],
-                           qi3[best_path], qi4[best_path], cstart[best_path], cend[best_path], ci1[best_path],
-                           ci2[best_path], length[best_path]);
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_CC_REEDS_SHEPP, TcScT);
+  if (families.TcScT_exists(c1, c2))
+  {
+    INSTRUMENTATION_FAMILY_HIT(TcScT);
+    candidate.reset(TcScT);
+    *candidate.cstart_slot() = HC_CC_Circle(c1);
+    *candidate.cend_slot() = HC_CC_Circle(c2);
+    candidate.length =
+        families.TcScT_path(candidate.cstart, candidate.cend, candidate.qi1_slot(), candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_END(TcScT);
+}
 
-  // clean up
-  for (int i = 0; i < nb_hc_cc_rs_paths; i++)
-  {
-    if (i != best_path)
-    {
-      delete qi1[i];
-      delete qi2[i];
-      delete qi3[i];
-      delete qi4[i];
-      delete cstart[i];
-      delete ci1[i];
-      delete ci2[i];
-      delete cend[i];
-    }
-  }
-  return path;
+HC_CC_RS_Path *CC_Reeds_Shepp_State_Space::cc_circles_rs_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2) const
+{
+  HC_CC_RS_Path_Candidate path;
+  cc_circles_rs_path(c1, c2, &path);
+  return path.materialize(c1.start, c2.start, kappa_, sigma_);
 }
 
-HC_CC_RS_Path *CC_Reeds_Shepp_State_Space::cc_reeds_shepp(const State &state1, const State &state2) const
+void CC_Reeds_Shepp_State_Space::cc_start_circles(const State &state1, HC_CC_Circle *start_circle) const
 {
-  // compute the 4 circles at the intial and final configuration
+  // compute the 4 circles at the initial configuration
   Configuration start(state1.x, state1.y, state1.theta, 0.0);
+  start_circle[0] = HC_CC_Circle(start, true, true, CC_REGULAR, hc_cc_circle_param_);
+  start_circle[1] = HC_CC_Circle(start, false, true, CC_REGULAR, hc_cc_circle_param_);
+  start_circle[2] = HC_CC_Circle(start, true, false, CC_REGULAR, hc_cc_circle_param_);
+  start_circle[3] = HC_CC_Circle(start, false, false, CC_REGULAR, hc_cc_circle_param_);
+}
+
+void CC_Reeds_Shepp_State_Space::cc_reeds_shepp(const HC_CC_Circle *start_circle, const State &state2,
+                                                HC_CC_RS_Path_Candidate *path) const
+{
+  // compute the 4 circles at the final configuration
   Configuration end(state2.x, state2.y, state2.theta, 0.0);
 
-  HC_CC_Circle *start_circle[4];
-  HC_CC_Circle *end_circle[4];
-  start_circle[0] = new HC_CC_Circle(start, true, true, CC_REGULAR, hc_cc_circle_param_);
-  start_circle[1] = new HC_CC_Circle(start, false, true, CC_REGULAR, hc_cc_circle_param_);
-  start_circle[2] = new HC_CC_Circle(start, true, false, CC_REGULAR, hc_cc_circle_param_);
-  start_circle[3] = new HC_CC_Circle(start, false, false, CC_REGULAR, hc_cc_circle_param_);
-  end_circle[0] = new HC_CC_Circle(end, true, true, CC_REGULAR, hc_cc_circle_param_);
-  end_circle[1] = new HC_CC_Circle(end, false, true, CC_REGULAR, hc_cc_circle_param_);
-  end_circle[2] = new HC_CC_Circle(end, true, false, CC_REGULAR, hc_cc_circle_param_);
-  end_circle[3] = new HC_CC_Circle(end, false, false, CC_REGULAR, hc_cc_circle_param_);
+  HC_CC_Circle end_circle[] = { HC_CC_Circle(end, true, true, CC_REGULAR, hc_cc_circle_param_),
+                                HC_CC_Circle(end, false, true, CC_REGULAR, hc_cc_circle_param_),
+                                HC_CC_Circle(end, true, false, CC_REGULAR, hc_cc_circle_param_),
+                                HC_CC_Circle(end, false, false, CC_REGULAR, hc_cc_circle_param_) };
 
   // compute the shortest path for the 16 combinations (4 circles at the beginning and 4 at the end)
-  HC_CC_RS_Path *path[] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
-
-  double lg[] = { numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max() };
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
 
   for (int i = 0; i < 4; i++)
   {
     for (int j = 0; j < 4; j++)
     {
-      path[4 * i + j] = cc_circles_rs_path(*start_circle[i], *end_circle[j]);
-      if (path[4 * i + j])
-      {
-        lg[4 * i + j] = path[4 * i + j]->length;
-      }
+      cc_circles_rs_path(start_circle[i], end_circle[j], &candidate);
+      path->assign_if_shorter(candidate);
     }
   }
+  INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_CC_REEDS_SHEPP, path->type);
+}
 
-  // select shortest path
-  int best_path = array_index_min(lg, 16);
-
-  //  // display calculations
-  //  cout << "CC_Reeds_Shepp_State_Space" << endl;
-  //  for (int i = 0; i < 16; i++)
-  //  {
-  //    cout << i << ": ";
-  //    if (path[i])
-  //    {
-  //      path[i]->print(true);
-  //      cout << endl;
-  //    }
-  //  }
-  //  cout << "shortest path: " << (int)best_path << endl;
-  //  path[best_path]->print(true);
+void CC_Reeds_Shepp_State_Space::cc_reeds_shepp(const State &state1, const State &state2,
+                                                HC_CC_RS_Path_Candidate *path) const
+{
+  HC_CC_Circle start_circle[4];
+  cc_start_circles(state1, start_circle);
+  cc_reeds_shepp(start_circle, state2, path);
+}
 
-  // clean up
-  for (int i = 0; i < 4; i++)
-  {
-    delete start_circle[i];
-    delete end_circle[i];
-  }
-  for (int i = 0; i < 16; i++)
-  {
-    if (i != best_path)
-    {
-      delete path[i];
-    }
-  }
-  return path[best_path];
+HC_CC_RS_Path *CC_Reeds_Shepp_State_Space::cc_reeds_shepp(const State &state1, const State &state2) const
+{
+  HC_CC_RS_Path_Candidate path;
+  cc_reeds_shepp(state1, state2, &path);
+  Configuration start(state1.x, state1.y, state1.theta, 0);
+  Configuration end(state2.x, state2.y, state2.theta, 0);
+  return path.materialize(start, end, kappa_, sigma_);
 }
 
 double CC_Reeds_Shepp_State_Space::get_distance(const State &state1, const State &state2) const
 {
-  HC_CC_RS_Path *p = this->cc_reeds_shepp(state1, state2);
-  double length = p->length;
-  delete p;
-  return length;
+  HC_CC_RS_Path_Candidate path;
+  this->cc_reeds_shepp(state1, state2, &path);
+  return path.length;
+}
+
+void CC_Reeds_Shepp_State_Space::get_distances(const State &state1, const State *states2, size_t n,
+                                               double *distances) const
+{
+  HC_CC_Circle start_circle[4];
+  cc_start_circles(state1, start_circle);
+  HC_CC_RS_Path_Candidate path;
+  for (size_t i = 0; i < n; i++)
+  {
+    cc_reeds_shepp(start_circle, states2[i], &path);
+    distances[i] = path.length;
+  }
 }
 
 vector<Control> CC_Reeds_Shepp_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> cc_rs_controls;
   cc_rs_controls.reserve(5);
-  HC_CC_RS_Path *p = this->cc_reeds_shepp(state1, state2);
-  switch (p->type)
+  HC_CC_RS_Path_Candidate p;
+  this->cc_reeds_shepp(state1, state2, &p);
+  Configuration start(state1.x, state1.y, state1.theta, 0);
+  Configuration end(state2.x, state2.y, state2.theta, 0);
+  switch (p.type)
   {
     case EMPTY:
       empty_controls(cc_rs_controls);
       break;
     case STRAIGHT:
-      straight_controls(p->start, p->end, cc_rs_controls);
+      straight_controls(start, end, cc_rs_controls);
       break;
     case T:
-      cc_turn_controls(*(p->cstart), p->end, true, cc_rs_controls);
+      cc_turn_controls(p.cstart, end, true, cc_rs_controls);
       break;
     case TT:
     case TcT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi1), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi1, false, cc_rs_controls);
       break;
     // ##### Reeds-Shepp families: ############################################
     case TcTcT:
     case TcTT:
     case TTcT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_rs_controls);
       break;
     case TST:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      straight_controls(*(p->qi1), *(p->qi2), cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      straight_controls(p.qi1, p.qi2, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_rs_controls);
       break;
     case TSTcT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      straight_controls(*(p->qi1), *(p->qi2), cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi3), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      straight_controls(p.qi1, p.qi2, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi3, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, cc_rs_controls);
       break;
     case TcTST:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_rs_controls);
+      straight_controls(p.qi2, p.qi3, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, cc_rs_controls);
       break;
     case TcTSTcT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), cc_rs_controls);
-      cc_turn_controls(*(p->ci2), *(p->qi4), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi4), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_rs_controls);
+      straight_controls(p.qi2, p.qi3, cc_rs_controls);
+      cc_turn_controls(p.ci2, p.qi4, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi4, false, cc_rs_controls);
       break;
     case TTcTT:
     case TcTTcT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci2), *(p->qi3), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_rs_controls);
+      cc_turn_controls(p.ci2, p.qi3, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, cc_rs_controls);
       break;
     // ########################################################################
     case TTT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_rs_controls);
       break;
     case TcST:
     case TScT:
     case TcScT:
-      cc_turn_controls(*(p->cstart), *(p->qi1), true, cc_rs_controls);
-      straight_controls(*(p->qi1), *(p->qi2), cc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, cc_rs_controls);
+      cc_turn_controls(p.cstart, p.qi1, true, cc_rs_controls);
+      straight_controls(p.qi1, p.qi2, cc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, cc_rs_controls);
       break;
     default:
       break;
   }
-  delete p;
   return cc_rs_controls;
 }
@@ -0,0 +1,90 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include "steering_functions/hc_cc_state_space/fresnel_batch.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+#include "simd/simd_avx2.hpp"
+
+namespace
+{
+typedef Vec<Avx2> V;
+
+/** \brief Coefficients (C, S) at lo and hi in the lower and upper half */
+__m256d load_pairs(const double *lo, const double *hi)
+{
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(lo)), _mm_loadu_pd(hi), 1);
+}
+
+void fresnel_cs(const double *x, double *c, double *s, size_t n)
+{
+  using namespace fresnel_batch;
+  const double *expansions = get_expansions();
+  const double x_max = nb_intervals / static_cast<double>(intervals_per_unit);
+  const __m128i stride = _mm_set1_epi32(2 * (degree + 1));
+  size_t i = 0;
+  for (; i + Avx2::WIDTH <= n; i += Avx2::WIDTH)
+  {
+    V vx = Avx2::load(x + i);
+    V ux = fabs(vx);
+    Mask<Avx2> in_range = ux < V(x_max);
+    // lanes out of range (asymptotic expansion, NaN) are evaluated on the first interval and replaced below
+    ux = select(in_range, ux, V(0.));
+    V k = trunc(ux * V(intervals_per_unit));
+    V h = ux - (k + V(0.5)) / V(intervals_per_unit);
+    __m128i index = _mm_mullo_epi32(_mm256_cvttpd_epi32(k.v), stride);
+    const double *coeffs0 = expansions + _mm_extract_epi32(index, 0);
+    const double *coeffs1 = expansions + _mm_extract_epi32(index, 1);
+    const double *coeffs2 = expansions + _mm_extract_epi32(index, 2);
+    const double *coeffs3 = expansions + _mm_extract_epi32(index, 3);
+    // as in the scalar evaluation, C and S of a lane are evaluated in a single Horner scheme: (C0, S0, C1, S1) and
+    // (C2, S2, C3, S3)
+    V h01 = _mm256_permute4x64_pd(h.v, 0x50);
+    V h23 = _mm256_permute4x64_pd(h.v, 0xfa);
+    V r01 = load_pairs(coeffs0, coeffs1);
+    V r23 = load_pairs(coeffs2, coeffs3);
+    for (int j = 1; j <= degree; j++)
+    {
+      r01 = r01 * h01 + V(load_pairs(coeffs0 + 2 * j, coeffs1 + 2 * j));
+      r23 = r23 * h23 + V(load_pairs(coeffs2 + 2 * j, coeffs3 + 2 * j));
+    }
+    V cc = _mm256_permute4x64_pd(_mm256_unpacklo_pd(r01.v, r23.v), 0xd8);
+    V ss = _mm256_permute4x64_pd(_mm256_unpackhi_pd(r01.v, r23.v), 0xd8);
+    // C and S are odd functions
+    Mask<Avx2> negative = signbit(vx);
+    Avx2::store(c + i, select(negative, -fabs(cc), fabs(cc)).v);
+    Avx2::store(s + i, select(negative, -fabs(ss), fabs(ss)).v);
+    if (_mm256_movemask_pd(in_range.m) != (1 << Avx2::WIDTH) - 1)
+    {
+      for (size_t j = i; j < i + Avx2::WIDTH; j++)
+        if (!(std::fabs(x[j]) < x_max))
+          ::fresnel_cs(x[j], c + j, s + j);
+    }
+  }
+  for (; i < n; i++)
+    ::fresnel_cs(x[i], c + i, s + i);
+}
+}
+
+const fresnel_batch::Fresnel_Function fresnel_batch::avx2_fresnel_cs = fresnel_cs;
+
+#else
+
+const fresnel_batch::Fresnel_Function fresnel_batch::avx2_fresnel_cs = nullptr;
+
+#endif
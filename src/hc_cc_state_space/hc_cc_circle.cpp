@@ -37,6 +37,23 @@ void HC_CC_Circle_Param::set_param(double _kappa, double _sigma, double _radius,
   delta_min = _delta_min;
 }
 
+HC_CC_Circle::HC_CC_Circle()
+{
+  start = Configuration(0, 0, 0, 0);
+  left = true;
+  forward = true;
+  regular = true;
+  kappa = 0;
+  sigma = 0;
+  xc = 0;
+  yc = 0;
+  radius = 0;
+  mu = 0;
+  sin_mu = 0;
+  cos_mu = 1;
+  delta_min = 0;
+}
+
 HC_CC_Circle::HC_CC_Circle(const Configuration &_start, bool _left, bool _forward, bool _regular,
                            const HC_CC_Circle_Param &_param)
 {
@@ -168,10 +185,10 @@ double HC_CC_Circle::cc_turn_length(const Configuration &q) const
   assert(fabs(q.kappa) < get_epsilon());
   double delta;
   this->deflection(q, &delta);
-  // straight line
+  // straight line (the length of the straight_controls from start to q)
   if (fabs(delta) < get_epsilon())
   {
-    return fabs(2 * this->radius * this->sin_mu);
+    return point_distance(this->start.x, this->start.y, q.x, q.y);
   }
   // elementary path
   if (delta < delta_min)
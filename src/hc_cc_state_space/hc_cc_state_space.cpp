@@ -49,10 +49,63 @@ HC_CC_State_Space::HC_CC_State_Space(double kappa, double sigma, double discreti
   hc_cc_circle_param_.set_param(kappa, sigma, radius, mu, sin_mu, cos_mu, delta_min);
 }
 
+void HC_CC_State_Space::get_distances(const State &state1, const State *states2, size_t n, double *distances) const
+{
+  for (size_t i = 0; i < n; i++)
+    distances[i] = this->get_distance(state1, states2[i]);
+}
+
 vector<State> HC_CC_State_Space::get_path(const State &state1, const State &state2) const
 {
   vector<Control> controls = this->get_controls(state1, state2);
-  return this->forward_euler(state1, controls);
+  return this->integrate(state1, controls);
+}
+
+Path_Range HC_CC_State_Space::get_path_range(const State &state1, const State &state2) const
+{
+  return this->get_path_range(state1, this->get_controls(state1, state2));
+}
+
+Path_Range HC_CC_State_Space::get_path_range(const State &state, const vector<Control> &controls) const
+{
+  Path_Range::Convention convention = { pify, true };
+  return Path_Range(state, controls, discretization_, convention);
+}
+
+State HC_CC_State_Space::state_at(const State &state, const vector<Control> &controls, double s) const
+{
+  return this->get_path_range(state, controls).state_at(s);
+}
+
+void HC_CC_State_Space::states_at(const State &state, const vector<Control> &controls, const double *s, size_t n,
+                                  State *states) const
+{
+  this->get_path_range(state, controls).states_at(s, n, states);
+}
+
+size_t HC_CC_State_Space::sample_path(const State &state, const vector<Control> &controls, double *x, double *y,
+                                      double *theta, double *kappa, double *d, size_t capacity) const
+{
+  Path_Range::Convention convention = { pify, true };
+  return Path_Range::sample(state, controls, discretization_, convention, x, y, theta, kappa, d, capacity);
+}
+
+vector<State> HC_CC_State_Space::integrate(const State &state, const vector<Control> &controls) const
+{
+  Path_Range::Convention convention = { pify, true };
+  return Path_Range::sample(state, controls, discretization_, convention);
+}
+
+vector<State> HC_CC_State_Space::get_path_adaptive(const State &state1, const State &state2, double tolerance) const
+{
+  return this->integrate_adaptive(state1, this->get_controls(state1, state2), tolerance);
+}
+
+vector<State> HC_CC_State_Space::integrate_adaptive(const State &state, const vector<Control> &controls,
+                                                    double tolerance) const
+{
+  Path_Range::Convention convention = { pify, true };
+  return Path_Range::sample_adaptive(state, controls, tolerance, convention);
 }
 
 vector<State> HC_CC_State_Space::forward_euler(const State &state, const vector<Control> &controls) const
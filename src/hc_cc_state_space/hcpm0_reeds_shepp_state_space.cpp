@@ -24,6 +24,7 @@
 **********************************************************************/
 
 #include "steering_functions/hc_cc_state_space/hcpm0_reeds_shepp_state_space.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 
 #define HC_REGULAR false
 #define CC_REGULAR false
@@ -31,10 +32,10 @@
 class HCpm0_Reeds_Shepp_State_Space::HCpm0_Reeds_Shepp
 {
 private:
-  HCpm0_Reeds_Shepp_State_Space *parent_;
+  const HCpm0_Reeds_Shepp_State_Space *parent_;
 
 public:
-  explicit HCpm0_Reeds_Shepp(HCpm0_Reeds_Shepp_State_Space *parent)
+  explicit HCpm0_Reeds_Shepp(const HCpm0_Reeds_Shepp_State_Space *parent)
   {
     parent_ = parent;
   }
@@ -56,8 +57,8 @@ public:
     return fabs(distance - 2 * c2.radius) < get_epsilon();
   }
 
-  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                 Configuration **q1, Configuration **q2)
+  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                 Configuration *q1, Configuration *q2)
   {
     double x = (c1.xc + c2.xc) / 2;
     double y = (c1.yc + c2.yc) / 2;
@@ -85,13 +86,13 @@ public:
         theta = angle - HALF_PI - c2.mu;
       }
     }
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
     if (cstart && cend && q1)
     {
-      *cstart = new HC_CC_Circle(**q2, !c2.left, c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      return (*cstart)->hc_turn_length(**q1) + (*cend)->cc_turn_length(**q2);
+      *cstart = HC_CC_Circle(*q2, !c2.left, c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      return cstart->hc_turn_length(*q1) + cend->cc_turn_length(*q2);
     }
     return numeric_limits<double>::max();
   }
@@ -110,8 +111,8 @@ public:
     return fabs(distance - fabs(2 / c1.kappa)) < get_epsilon();
   }
 
-  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q)
+  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q)
   {
     double distance = center_distance(c1, c2);
     double delta_x = 0.5 * distance;
@@ -144,12 +145,12 @@ public:
         global_frame_change(c1.xc, c1.yc, angle, delta_x, delta_y, &x, &y);
       }
     }
-    *q = new Configuration(x, y, theta, c1.kappa);
+    *q = Configuration(x, y, theta, c1.kappa);
     if (cstart && cend)
     {
-      *cstart = new HC_CC_Circle(c1);
-      *cend = new HC_CC_Circle(c2);
-      return (*cstart)->rs_turn_length(**q) + (*cend)->hc_turn_length(**q);
+      *cstart = HC_CC_Circle(c1);
+      *cend = HC_CC_Circle(c2);
+      return cstart->rs_turn_length(*q) + cend->hc_turn_length(*q);
     }
     return numeric_limits<double>::max();
   }
@@ -170,8 +171,8 @@ public:
     return distance <= fabs(4 / c1.kappa);
   }
 
-  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4)
+  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = fabs(2 / c1.kappa);
@@ -190,29 +191,25 @@ public:
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
   }
 
-  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c2.left, c2.forward, true, parent_->rs_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c2.left, c2.forward, true, parent_->rs_circle_param_);
+    HC_CC_Circle middle1(qa, !c2.left, c2.forward, true, parent_->rs_circle_param_);
+    HC_CC_Circle middle2(qc, !c2.left, c2.forward, true, parent_->rs_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->rs_turn_length(*qb) + (*cend)->hc_turn_length(*qb);
-    double length2 = (*cstart)->rs_turn_length(*qc) + middle2->rs_turn_length(*qd) + (*cend)->hc_turn_length(*qd);
+    double length1 = cstart->rs_turn_length(qa) + middle1.rs_turn_length(qb) + cend->hc_turn_length(qb);
+    double length2 = cstart->rs_turn_length(qc) + middle2.rs_turn_length(qd) + cend->hc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -220,9 +217,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -242,8 +236,8 @@ public:
     return (distance <= 2 * c2.radius + 2 / fabs(c2.kappa)) && (distance >= 2 * c2.radius - 2 / fabs(c2.kappa));
   }
 
-  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 / fabs(c2.kappa);
@@ -263,29 +257,25 @@ public:
     TT_path(tgt2, c2, nullptr, nullptr, nullptr, q4);
   }
 
-  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->hc_turn_length(*qa) + (*cend)->cc_turn_length(*qb);
-    double length2 = (*cstart)->rs_turn_length(*qc) + middle2->hc_turn_length(*qc) + (*cend)->cc_turn_length(*qd);
+    double length1 = cstart->rs_turn_length(qa) + middle1.hc_turn_length(qa) + cend->cc_turn_length(qb);
+    double length2 = cstart->rs_turn_length(qc) + middle2.hc_turn_length(qc) + cend->cc_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -293,9 +283,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -315,8 +302,8 @@ public:
     return (distance <= 2 * c2.radius + 2 / fabs(c2.kappa)) && (distance >= 2 * c2.radius - 2 / fabs(c2.kappa));
   }
 
-  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 * c2.radius;
@@ -336,33 +323,27 @@ public:
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
   }
 
-  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *start1, *start2, *middle1, *middle2;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->hc_turn_length(*qb) + (*cend)->hc_turn_length(*qb);
-    double length2 = start2->hc_turn_length(**q1) + middle2->hc_turn_length(*qd) + (*cend)->hc_turn_length(*qd);
+    double length1 = start1.hc_turn_length(*q1) + middle1.hc_turn_length(qb) + cend->hc_turn_length(qb);
+    double length2 = start2.hc_turn_length(*q1) + middle2.hc_turn_length(qd) + cend->hc_turn_length(qd);
     if (length1 < length2)
     {
       *cstart = start1;
       *q2 = qb;
       *ci = middle1;
-      delete qa;
-      delete qc;
-      delete qd;
-      delete start2;
-      delete middle2;
       return length1;
     }
     else
@@ -370,11 +351,6 @@ public:
       *cstart = start2;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete start1;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -412,8 +388,8 @@ public:
     return TiST_exists(c1, c2) || TeST_exists(c1, c2);
   }
 
-  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3)
+  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double distance = center_distance(c1, c2);
     double angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
@@ -425,47 +401,47 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
 
     if (cstart && cend && q1)
     {
-      *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+      *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
     }
     return numeric_limits<double>::max();
   }
 
-  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3)
+  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double delta_x = fabs(c2.radius * c2.sin_mu);
     double delta_y = fabs(c2.radius * c2.cos_mu);
@@ -474,44 +450,44 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
 
     if (cstart && cend && q1)
     {
-      *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+      *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
     }
     return numeric_limits<double>::max();
   }
 
-  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q1, Configuration **q2, Configuration **q3)
+  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q1, Configuration *q2, Configuration *q3)
   {
     if (TiST_exists(c1, c2))
     {
@@ -557,8 +533,8 @@ public:
     return TiSTcT_exists(c1, c2) || TeSTcT_exists(c1, c2);
   }
 
-  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_y = (4 * c2.radius * c2.cos_mu) / (fabs(c2.kappa) * distance);
@@ -571,17 +547,17 @@ public:
     TiST_path(c1, tgt1, nullptr, nullptr, nullptr, q2, q3);
     TcT_path(tgt1, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *ci = new HC_CC_Circle(**q3, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *ci = HC_CC_Circle(*q3, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*ci)->hc_turn_length(**q4) +
-           (*cend)->hc_turn_length(**q4);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + ci->hc_turn_length(*q4) +
+           cend->hc_turn_length(*q4);
   }
 
-  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c2.kappa);
@@ -594,17 +570,17 @@ public:
     TeST_path(c1, tgt1, nullptr, nullptr, nullptr, q2, q3);
     TcT_path(tgt1, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *ci = new HC_CC_Circle(**q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *ci = HC_CC_Circle(*q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*ci)->hc_turn_length(**q4) +
-           (*cend)->hc_turn_length(**q4);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + ci->hc_turn_length(*q4) +
+           cend->hc_turn_length(*q4);
   }
 
-  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     if (TiSTcT_exists(c1, c2))
     {
@@ -650,8 +626,8 @@ public:
     return TcTiST_exists(c1, c2) || TcTeST_exists(c1, c2);
   }
 
-  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci)
+  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_y = (4 * c2.radius * c2.cos_mu) / (fabs(c2.kappa) * distance);
@@ -664,16 +640,16 @@ public:
     TcT_path(c1, tgt1, nullptr, nullptr, q1);
     TiST_path(tgt1, c2, nullptr, nullptr, nullptr, q2, q3);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *ci = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*cend)->cc_turn_length(**q3);
+    return cstart->rs_turn_length(*q1) + ci->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           cend->cc_turn_length(*q3);
   }
 
-  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci)
+  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c2.kappa);
@@ -686,16 +662,16 @@ public:
     TcT_path(c1, tgt1, nullptr, nullptr, q1);
     TeST_path(tgt1, c2, nullptr, nullptr, nullptr, q2, q3);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *ci = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *ci = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*cend)->cc_turn_length(**q3);
+    return cstart->rs_turn_length(*q1) + ci->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           cend->cc_turn_length(*q3);
   }
 
-  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci)
+  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci)
   {
     if (TcTiST_exists(c1, c2))
     {
@@ -741,9 +717,9 @@ public:
     return TcTiSTcT_exists(c1, c2) || TcTeSTcT_exists(c1, c2);
   }
 
-  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                       Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                       HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                       Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                       HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double delta_y = (4 * c2.radius * c2.cos_mu) / (distance * fabs(c2.kappa));
@@ -759,18 +735,18 @@ public:
     TiST_path(tgt1, tgt2, nullptr, nullptr, nullptr, q2, q3);
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    *ci1 = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    *ci1 = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci1)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*ci2)->hc_turn_length(**q4) + (*cend)->hc_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci1->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           ci2->hc_turn_length(*q4) + cend->hc_turn_length(*q4);
   }
 
-  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                       Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                       HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                       Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                       HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c1.kappa);
@@ -786,18 +762,18 @@ public:
     TeST_path(tgt1, tgt2, nullptr, nullptr, nullptr, q2, q3);
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    *ci1 = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    *ci1 = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci1)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*ci2)->hc_turn_length(**q4) + (*cend)->hc_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci1->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           ci2->hc_turn_length(*q4) + cend->hc_turn_length(*q4);
   }
 
-  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                      Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                      HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                      Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                      HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     if (TcTiSTcT_exists(c1, c2))
     {
@@ -824,8 +800,8 @@ public:
     return (distance <= 4 * c2.radius + 2 / fabs(c2.kappa));
   }
 
-  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1, r2, delta_x, delta_y, x, y;
@@ -861,27 +837,26 @@ public:
     TT_path(tgt4, c2, nullptr, nullptr, nullptr, q6);
   }
 
-  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TTcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *start1, *start2, *middle1, *middle2, *middle3, *middle4;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qd, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qf, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qd, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qf, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->hc_turn_length(*qb) + middle2->hc_turn_length(*qb) +
-                     (*cend)->cc_turn_length(*qc);
-    double length2 = start2->hc_turn_length(**q1) + middle3->hc_turn_length(*qe) + middle4->hc_turn_length(*qe) +
-                     (*cend)->cc_turn_length(*qf);
+    double length1 = start1.hc_turn_length(*q1) + middle1.hc_turn_length(qb) + middle2.hc_turn_length(qb) +
+                     cend->cc_turn_length(qc);
+    double length2 = start2.hc_turn_length(*q1) + middle3.hc_turn_length(qe) + middle4.hc_turn_length(qe) +
+                     cend->cc_turn_length(qf);
     if (length1 < length2)
     {
       *cstart = start1;
@@ -889,13 +864,6 @@ public:
       *q3 = qc;
       *ci1 = middle1;
       *ci2 = middle2;
-      delete qa;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete start2;
-      delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -905,13 +873,6 @@ public:
       *q3 = qf;
       *ci1 = middle3;
       *ci2 = middle4;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete qd;
-      delete start1;
-      delete middle1;
-      delete middle2;
       return length2;
     }
 
@@ -932,8 +893,8 @@ public:
     return (distance <= 4 / fabs(c2.kappa) + 2 * c2.radius) && (distance >= 4 / fabs(c2.kappa) - 2 * c2.radius);
   }
 
-  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                              Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                              Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1 = 2 / fabs(c2.kappa);
@@ -961,37 +922,30 @@ public:
     TcT_path(tgt4, c2, nullptr, nullptr, q6);
   }
 
-  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TcTTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *middle1, *middle2, *middle3, *middle4;
-    middle1 = new HC_CC_Circle(*qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qb, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qe, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qe, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qb, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qe, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qe, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->hc_turn_length(*qa) + middle2->hc_turn_length(*qc) +
-                     (*cend)->hc_turn_length(*qc);
-    double length2 = (*cstart)->rs_turn_length(*qd) + middle3->hc_turn_length(*qd) + middle4->hc_turn_length(*qf) +
-                     (*cend)->hc_turn_length(*qf);
+    double length1 = cstart->rs_turn_length(qa) + middle1.hc_turn_length(qa) + middle2.hc_turn_length(qc) +
+                     cend->hc_turn_length(qc);
+    double length2 = cstart->rs_turn_length(qd) + middle3.hc_turn_length(qd) + middle4.hc_turn_length(qf) +
+                     cend->hc_turn_length(qf);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qc;
       *ci1 = middle1;
       *ci2 = middle2;
-      delete qb;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -1000,12 +954,6 @@ public:
       *q2 = qf;
       *ci1 = middle3;
       *ci2 = middle4;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete qe;
-      delete middle1;
-      delete middle2;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -1027,8 +975,8 @@ public:
     return distance <= 4 * c2.radius;
   }
 
-  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                           Configuration **q3, Configuration **q4)
+  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                           Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = 2 * c2.radius;
@@ -1047,33 +995,27 @@ public:
     TT_path(tgt2, c2, nullptr, nullptr, nullptr, q4);
   }
 
-  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *start1, *start2, *middle1, *middle2;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
 
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->cc_turn_length(*qb) + (*cend)->cc_turn_length(*qb);
-    double length2 = start2->hc_turn_length(**q1) + middle2->cc_turn_length(*qd) + (*cend)->cc_turn_length(*qd);
+    double length1 = start1.hc_turn_length(*q1) + middle1.cc_turn_length(qb) + cend->cc_turn_length(qb);
+    double length2 = start2.hc_turn_length(*q1) + middle2.cc_turn_length(qd) + cend->cc_turn_length(qd);
     if (length1 < length2)
     {
       *cstart = start1;
       *q2 = qb;
       *ci = middle1;
-      delete qa;
-      delete qc;
-      delete qd;
-      delete start2;
-      delete middle2;
       return length1;
     }
     else
@@ -1081,11 +1023,6 @@ public:
       *cstart = start2;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete start1;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -1123,8 +1060,8 @@ public:
     return TciST_exists(c1, c2) || TceST_exists(c1, c2);
   }
 
-  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3)
+  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double alpha = fabs(asin(2 * c2.radius * c2.cos_mu / distance));
     double delta_x = fabs(c2.radius * c2.sin_mu);
@@ -1134,42 +1071,42 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
   }
 
-  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3)
+  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double delta_x = fabs(c2.radius * c2.sin_mu);
     double delta_y = fabs(c2.radius * c2.cos_mu);
@@ -1178,39 +1115,39 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
   }
 
-  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3)
+  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3)
   {
     if (TciST_exists(c1, c2))
     {
@@ -1255,8 +1192,8 @@ public:
     return TiScT_exists(c1, c2) || TeScT_exists(c1, c2);
   }
 
-  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3)
+  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double alpha = fabs(asin(2 * c2.radius * c2.cos_mu / distance));
 
@@ -1268,42 +1205,42 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
   }
 
-  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3)
+  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double delta_x = fabs(c2.radius * c2.sin_mu);
     double delta_y = fabs(c2.radius * c2.cos_mu);
@@ -1312,39 +1249,39 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->cc_turn_length(**q3);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2.start, c2.left, c2.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->cc_turn_length(*q3);
   }
 
-  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3)
+  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3)
   {
     if (TiScT_exists(c1, c2))
     {
@@ -1389,8 +1326,8 @@ public:
     return TciScT_exists(c1, c2) || TceScT_exists(c1, c2);
   }
 
-  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2)
+  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2)
   {
     double alpha = fabs(asin(2 / (c2.kappa * distance)));
     double delta_x = 0.0;
@@ -1400,41 +1337,41 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    return (*cstart)->rs_turn_length(**q1) + configuration_distance(**q1, **q2) + (*cend)->hc_turn_length(**q2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    return cstart->rs_turn_length(*q1) + configuration_distance(*q1, *q2) + cend->hc_turn_length(*q2);
   }
 
-  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2)
+  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2)
   {
     double delta_x = 0.0;
     double delta_y = fabs(1 / c2.kappa);
@@ -1443,38 +1380,38 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    return (*cstart)->rs_turn_length(**q1) + configuration_distance(**q1, **q2) + (*cend)->hc_turn_length(**q2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    return cstart->rs_turn_length(*q1) + configuration_distance(*q1, *q2) + cend->hc_turn_length(*q2);
   }
 
-  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2)
+  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2)
   {
     if (TciScT_exists(c1, c2))
     {
@@ -1492,7 +1429,6 @@ public:
 
 HCpm0_Reeds_Shepp_State_Space::HCpm0_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization)
   : HC_CC_State_Space(kappa, sigma, discretization)
-  , hcpm0_reeds_shepp_{ unique_ptr<HCpm0_Reeds_Shepp>(new HCpm0_Reeds_Shepp(this)) }
 {
   rs_circle_param_.set_param(kappa_, numeric_limits<double>::max(), 1 / kappa_, 0.0, 0.0, 1.0, 0.0);
   radius_ = hc_cc_circle_param_.radius;
@@ -1501,187 +1437,238 @@ HCpm0_Reeds_Shepp_State_Space::HCpm0_Reeds_Shepp_State_Space(double kappa, doubl
 
 HCpm0_Reeds_Shepp_State_Space::~HCpm0_Reeds_Shepp_State_Space() = default;
 
-HC_CC_RS_Path *HCpm0_Reeds_Shepp_State_Space::hcpm0_circles_rs_path(const HC_CC_Circle &c1,
-                                                                    const HC_CC_Circle &c2) const
+void HCpm0_Reeds_Shepp_State_Space::hcpm0_circles_rs_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2,
+                                                          HC_CC_RS_Path_Candidate *path) const
 {
-  // table containing the lengths of the paths, the intermediate configurations and circles
-  double length[nb_hc_cc_rs_paths];
-  double_array_init(length, nb_hc_cc_rs_paths, numeric_limits<double>::max());
-  Configuration *qi1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi1, nb_hc_cc_rs_paths);
-  Configuration *qi2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi2, nb_hc_cc_rs_paths);
-  Configuration *qi3[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi3, nb_hc_cc_rs_paths);
-  Configuration *qi4[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi4, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cstart[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cstart, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci1, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci2, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cend[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cend, nb_hc_cc_rs_paths);
+  // slot of the family under evaluation, the shortest family is kept in path
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
+
+  // families and precomputations of this query, a per-call instance keeps the state space reentrant
+  HCpm0_Reeds_Shepp families(this);
 
   // precomputations
-  hcpm0_reeds_shepp_->distance = center_distance(c1, c2);
-  hcpm0_reeds_shepp_->angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
+  families.distance = center_distance(c1, c2);
+  families.angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
 
   // case Empty
   if (configuration_equal(c1.start, c2.start))
   {
-    length[EMPTY] = 0;
-    goto label_end;
+    path->length = 0;
+    return;
   }
   // case T
-  if (hcpm0_reeds_shepp_->distance < get_epsilon())
+  if (families.distance < get_epsilon())
   {
-    cend[T] = new HC_CC_Circle(c2.start, c2.left, c2.forward, HC_REGULAR, hc_cc_circle_param_);
-    length[T] = cend[T]->hc_turn_length(c1.start);
-    goto label_end;
+    path->reset(T);
+    *path->cend_slot() = HC_CC_Circle(c2.start, c2.left, c2.forward, HC_REGULAR, hc_cc_circle_param_);
+    path->length = path->cend.hc_turn_length(c1.start);
+    return;
   }
   // case TT
-  if (hcpm0_reeds_shepp_->TT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TT);
+  if (families.TT_exists(c1, c2))
   {
-    length[TT] = hcpm0_reeds_shepp_->TT_path(c1, c2, &cstart[TT], &cend[TT], &qi1[TT], &qi2[TT]);
+    INSTRUMENTATION_FAMILY_HIT(TT);
+    candidate.reset(TT);
+    candidate.length = families.TT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                        candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TT);
   // case TcT
-  if (hcpm0_reeds_shepp_->TcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcT);
+  if (families.TcT_exists(c1, c2))
   {
-    length[TcT] = hcpm0_reeds_shepp_->TcT_path(c1, c2, &cstart[TcT], &cend[TcT], &qi1[TcT]);
+    INSTRUMENTATION_FAMILY_HIT(TcT);
+    candidate.reset(TcT);
+    candidate.length = families.TcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcT);
   // ##### Reeds-Shepp families: ############################################
   // case TcTcT
-  if (hcpm0_reeds_shepp_->TcTcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcTcT);
+  if (families.TcTcT_exists(c1, c2))
   {
-    length[TcTcT] =
-        hcpm0_reeds_shepp_->TcTcT_path(c1, c2, &cstart[TcTcT], &cend[TcTcT], &qi1[TcTcT], &qi2[TcTcT], &ci1[TcTcT]);
+    INSTRUMENTATION_FAMILY_HIT(TcTcT);
+    candidate.reset(TcTcT);
+    candidate.length = families.TcTcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                           candidate.qi2_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcTcT);
   // case TcTT
-  if (hcpm0_reeds_shepp_->TcTT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcTT);
+  if (families.TcTT_exists(c1, c2))
   {
-    length[TcTT] =
-        hcpm0_reeds_shepp_->TcTT_path(c1, c2, &cstart[TcTT], &cend[TcTT], &qi1[TcTT], &qi2[TcTT], &ci1[TcTT]);
+    INSTRUMENTATION_FAMILY_HIT(TcTT);
+    candidate.reset(TcTT);
+    candidate.length = families.TcTT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                          candidate.qi2_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcTT);
   // case TTcT
-  if (hcpm0_reeds_shepp_->TTcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TTcT);
+  if (families.TTcT_exists(c1, c2))
   {
-    length[TTcT] =
-        hcpm0_reeds_shepp_->TTcT_path(c1, c2, &cstart[TTcT], &cend[TTcT], &qi1[TTcT], &qi2[TTcT], &ci1[TTcT]);
+    INSTRUMENTATION_FAMILY_HIT(TTcT);
+    candidate.reset(TTcT);
+    candidate.length = families.TTcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                          candidate.qi2_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TTcT);
   // case TST
-  if (hcpm0_reeds_shepp_->TST_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TST);
+  if (families.TST_exists(c1, c2))
   {
-    length[TST] = hcpm0_reeds_shepp_->TST_path(c1, c2, &cstart[TST], &cend[TST], &qi1[TST], &qi2[TST], &qi3[TST]);
+    INSTRUMENTATION_FAMILY_HIT(TST);
+    candidate.reset(TST);
+    candidate.length = families.TST_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                         candidate.qi2_slot(), candidate.qi3_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TST);
   // case TSTcT
-  if (hcpm0_reeds_shepp_->TSTcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TSTcT);
+  if (families.TSTcT_exists(c1, c2))
   {
-    length[TSTcT] = hcpm0_reeds_shepp_->TSTcT_path(c1, c2, &cstart[TSTcT], &cend[TSTcT], &qi1[TSTcT], &qi2[TSTcT],
-                                                   &qi3[TSTcT], &qi4[TSTcT], &ci1[TSTcT]);
+    INSTRUMENTATION_FAMILY_HIT(TSTcT);
+    candidate.reset(TSTcT);
+    candidate.length = families.TSTcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                           candidate.qi2_slot(), candidate.qi3_slot(), candidate.qi4_slot(),
+                                           candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TSTcT);
   // case TcTST
-  if (hcpm0_reeds_shepp_->TcTST_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcTST);
+  if (families.TcTST_exists(c1, c2))
   {
-    length[TcTST] = hcpm0_reeds_shepp_->TcTST_path(c1, c2, &cstart[TcTST], &cend[TcTST], &qi1[TcTST], &qi2[TcTST],
-                                                   &qi3[TcTST], &ci1[TcTST]);
+    INSTRUMENTATION_FAMILY_HIT(TcTST);
+    candidate.reset(TcTST);
+    candidate.length = families.TcTST_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                           candidate.qi2_slot(), candidate.qi3_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcTST);
   // case TcTSTcT
-  if (hcpm0_reeds_shepp_->TcTSTcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcTSTcT);
+  if (families.TcTSTcT_exists(c1, c2))
   {
-    length[TcTSTcT] =
-        hcpm0_reeds_shepp_->TcTSTcT_path(c1, c2, &cstart[TcTSTcT], &cend[TcTSTcT], &qi1[TcTSTcT], &qi2[TcTSTcT],
-                                         &qi3[TcTSTcT], &qi4[TcTSTcT], &ci1[TcTSTcT], &ci2[TcTSTcT]);
+    INSTRUMENTATION_FAMILY_HIT(TcTSTcT);
+    candidate.reset(TcTSTcT);
+    candidate.length = families.TcTSTcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(),
+                                             candidate.qi1_slot(), candidate.qi2_slot(), candidate.qi3_slot(),
+                                             candidate.qi4_slot(), candidate.ci1_slot(), candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcTSTcT);
   // case TTcTT
-  if (hcpm0_reeds_shepp_->TTcTT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TTcTT);
+  if (families.TTcTT_exists(c1, c2))
   {
-    length[TTcTT] = hcpm0_reeds_shepp_->TTcTT_path(c1, c2, &cstart[TTcTT], &cend[TTcTT], &qi1[TTcTT], &qi2[TTcTT],
-                                                   &qi3[TTcTT], &ci1[TTcTT], &ci2[TTcTT]);
+    INSTRUMENTATION_FAMILY_HIT(TTcTT);
+    candidate.reset(TTcTT);
+    candidate.length = families.TTcTT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                           candidate.qi2_slot(), candidate.qi3_slot(), candidate.ci1_slot(),
+                                           candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TTcTT);
   // case TcTTcT
-  if (hcpm0_reeds_shepp_->TcTTcT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcTTcT);
+  if (families.TcTTcT_exists(c1, c2))
   {
-    length[TcTTcT] = hcpm0_reeds_shepp_->TcTTcT_path(c1, c2, &cstart[TcTTcT], &cend[TcTTcT], &qi1[TcTTcT], &qi2[TcTTcT],
-                                                     &ci1[TcTTcT], &ci2[TcTTcT]);
+    INSTRUMENTATION_FAMILY_HIT(TcTTcT);
+    candidate.reset(TcTTcT);
+    candidate.length = families.TcTTcT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(),
+                                            candidate.qi1_slot(), candidate.qi2_slot(), candidate.ci1_slot(),
+                                            candidate.ci2_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcTTcT);
   // ############################################################################
   // case TTT
-  if (hcpm0_reeds_shepp_->TTT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TTT);
+  if (families.TTT_exists(c1, c2))
   {
-    length[TTT] = hcpm0_reeds_shepp_->TTT_path(c1, c2, &cstart[TTT], &cend[TTT], &qi1[TTT], &qi2[TTT], &ci1[TTT]);
+    INSTRUMENTATION_FAMILY_HIT(TTT);
+    candidate.reset(TTT);
+    candidate.length = families.TTT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                         candidate.qi2_slot(), candidate.ci1_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TTT);
   // case TcST
-  if (hcpm0_reeds_shepp_->TcST_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcST);
+  if (families.TcST_exists(c1, c2))
   {
-    length[TcST] =
-        hcpm0_reeds_shepp_->TcST_path(c1, c2, &cstart[TcST], &cend[TcST], &qi1[TcST], &qi2[TcST], &qi3[TcST]);
+    INSTRUMENTATION_FAMILY_HIT(TcST);
+    candidate.reset(TcST);
+    candidate.length = families.TcST_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                          candidate.qi2_slot(), candidate.qi3_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TcST);
   // case TScT
-  if (hcpm0_reeds_shepp_->TScT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TScT);
+  if (families.TScT_exists(c1, c2))
   {
-    length[TScT] =
-        hcpm0_reeds_shepp_->TScT_path(c1, c2, &cstart[TScT], &cend[TScT], &qi1[TScT], &qi2[TScT], &qi3[TScT]);
+    INSTRUMENTATION_FAMILY_HIT(TScT);
+    candidate.reset(TScT);
+    candidate.length = families.TScT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                          candidate.qi2_slot(), candidate.qi3_slot());
+    path->assign_if_shorter(candidate);
   }
+  INSTRUMENTATION_FAMILY_END(TScT);
   // case TcScT
-  if (hcpm0_reeds_shepp_->TcScT_exists(c1, c2))
+  INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, TcScT);
+  if (families.TcScT_exists(c1, c2))
   {
-    length[TcScT] = hcpm0_reeds_shepp_->TcScT_path(c1, c2, &cstart[TcScT], &cend[TcScT], &qi1[TcScT], &qi2[TcScT]);
+    INSTRUMENTATION_FAMILY_HIT(TcScT);
+    candidate.reset(TcScT);
+    candidate.length = families.TcScT_path(c1, c2, candidate.cstart_slot(), candidate.cend_slot(), candidate.qi1_slot(),
+                                           candidate.qi2_slot());
+    path->assign_if_shorter(candidate);
   }
-label_end:
-  // select shortest path
-  hc_cc_rs_path_type best_path = (hc_cc_rs_path_type)array_index_min(length, nb_hc_cc_rs_paths);
-  HC_CC_RS_Path *path;
-  path = new HC_CC_RS_Path(c1.start, c2.start, best_path, kappa_, sigma_, qi1[best_path], qi2[best_path],
-                           qi3[best_path], qi4[best_path], cstart[best_path], cend[best_path], ci1[best_path],
-                           ci2[best_path], length[best_path]);
+  INSTRUMENTATION_FAMILY_END(TcScT);
+}
 
-  // clean up
-  for (int i = 0; i < nb_hc_cc_rs_paths; i++)
-  {
-    if (i != best_path)
-    {
-      delete qi1[i];
-      delete qi2[i];
-      delete qi3[i];
-      delete qi4[i];
-      delete cstart[i];
-      delete ci1[i];
-      delete ci2[i];
-      delete cend[i];
-    }
-  }
-  return path;
+HC_CC_RS_Path *HCpm0_Reeds_Shepp_State_Space::hcpm0_circles_rs_path(const HC_CC_Circle &c1,
+                                                                    const HC_CC_Circle &c2) const
+{
+  HC_CC_RS_Path_Candidate path;
+  hcpm0_circles_rs_path(c1, c2, &path);
+  return path.materialize(c1.start, c2.start, kappa_, sigma_);
 }
 
-HC_CC_RS_Path *HCpm0_Reeds_Shepp_State_Space::hcpm0_reeds_shepp(const State &state1, const State &state2) const
+void HCpm0_Reeds_Shepp_State_Space::hcpm0_start_circles(const State &state1, HC_CC_Circle *start_circle) const
 {
-  // compute the 4 circles at the intial and final configuration
+  // compute the 4 circles at the initial configuration
   Configuration start(state1.x, state1.y, state1.theta, state1.kappa);
+  start_circle[0] = HC_CC_Circle(start, true, true, true, rs_circle_param_);
+  start_circle[1] = HC_CC_Circle(start, false, true, true, rs_circle_param_);
+  start_circle[2] = HC_CC_Circle(start, true, false, true, rs_circle_param_);
+  start_circle[3] = HC_CC_Circle(start, false, false, true, rs_circle_param_);
+}
+
+void HCpm0_Reeds_Shepp_State_Space::hcpm0_reeds_shepp(const State &state1, const HC_CC_Circle *start_circle,
+                                                      const State &state2, HC_CC_RS_Path_Candidate *path) const
+{
+  // compute the 4 circles at the final configuration
   Configuration end(state2.x, state2.y, state2.theta, 0.0);
 
-  HC_CC_Circle *start_circle[4];
-  HC_CC_Circle *end_circle[4];
-  start_circle[0] = new HC_CC_Circle(start, true, true, true, rs_circle_param_);
-  start_circle[1] = new HC_CC_Circle(start, false, true, true, rs_circle_param_);
-  start_circle[2] = new HC_CC_Circle(start, true, false, true, rs_circle_param_);
-  start_circle[3] = new HC_CC_Circle(start, false, false, true, rs_circle_param_);
-  end_circle[0] = new HC_CC_Circle(end, true, true, true, hc_cc_circle_param_);
-  end_circle[1] = new HC_CC_Circle(end, false, true, true, hc_cc_circle_param_);
-  end_circle[2] = new HC_CC_Circle(end, true, false, true, hc_cc_circle_param_);
-  end_circle[3] = new HC_CC_Circle(end, false, false, true, hc_cc_circle_param_);
+  HC_CC_Circle end_circle[] = { HC_CC_Circle(end, true, true, true, hc_cc_circle_param_),
+                                HC_CC_Circle(end, false, true, true, hc_cc_circle_param_),
+                                HC_CC_Circle(end, true, false, true, hc_cc_circle_param_),
+                                HC_CC_Circle(end, false, false, true, hc_cc_circle_param_) };
 
   // compute the shortest path for the 16 combinations (4 circles at the beginning and 4 at the end)
-  HC_CC_RS_Path *path[] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
-
-  double lg[] = { numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max() };
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
 
   for (int i = 0; i < 4; i++)
   {
@@ -1696,146 +1683,143 @@ HC_CC_RS_Path *HCpm0_Reeds_Shepp_State_Space::hcpm0_reeds_shepp(const State &sta
       continue;
     for (int j = 0; j < 4; j++)
     {
-      path[4 * i + j] = hcpm0_circles_rs_path(*start_circle[i], *end_circle[j]);
-      if (path[4 * i + j])
-      {
-        lg[4 * i + j] = path[4 * i + j]->length;
-      }
+      hcpm0_circles_rs_path(start_circle[i], end_circle[j], &candidate);
+      path->assign_if_shorter(candidate);
     }
   }
+  INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_HCPM0_REEDS_SHEPP, path->type);
+}
 
-  // determine shortest path
-  int best_path = array_index_min(lg, 16);
-
-  //  // display calculations
-  //  cout << "HCpm0_Reeds_Shepp_State_Space" << endl;
-  //  for (int i = 0; i < 16; i++)
-  //  {
-  //    cout << i << ": ";
-  //    if (path[i])
-  //    {
-  //      path[i]->print(true);
-  //    }
-  //  }
-  //  cout << "shortest path: " << (int)best_path << endl;
-  //  path[best_path]->print(true);
+void HCpm0_Reeds_Shepp_State_Space::hcpm0_reeds_shepp(const State &state1, const State &state2,
+                                                      HC_CC_RS_Path_Candidate *path) const
+{
+  HC_CC_Circle start_circle[4];
+  hcpm0_start_circles(state1, start_circle);
+  hcpm0_reeds_shepp(state1, start_circle, state2, path);
+}
 
-  // clean up
-  for (int i = 0; i < 4; i++)
-  {
-    delete start_circle[i];
-    delete end_circle[i];
-  }
-  for (int i = 0; i < 16; i++)
-  {
-    if (i != best_path)
-    {
-      delete path[i];
-    }
-  }
-  return path[best_path];
+HC_CC_RS_Path *HCpm0_Reeds_Shepp_State_Space::hcpm0_reeds_shepp(const State &state1, const State &state2) const
+{
+  HC_CC_RS_Path_Candidate path;
+  hcpm0_reeds_shepp(state1, state2, &path);
+  Configuration start(state1.x, state1.y, state1.theta, 0);
+  Configuration end(state2.x, state2.y, state2.theta, 0);
+  return path.materialize(start, end, kappa_, sigma_);
 }
 
 double HCpm0_Reeds_Shepp_State_Space::get_distance(const State &state1, const State &state2) const
 {
-  HC_CC_RS_Path *p = this->hcpm0_reeds_shepp(state1, state2);
-  double length = p->length;
-  delete p;
-  return length;
+  HC_CC_RS_Path_Candidate path;
+  this->hcpm0_reeds_shepp(state1, state2, &path);
+  return path.length;
+}
+
+void HCpm0_Reeds_Shepp_State_Space::get_distances(const State &state1, const State *states2, size_t n,
+                                                  double *distances) const
+{
+  HC_CC_Circle start_circle[4];
+  hcpm0_start_circles(state1, start_circle);
+  HC_CC_RS_Path_Candidate path;
+  for (size_t i = 0; i < n; i++)
+  {
+    hcpm0_reeds_shepp(state1, start_circle, states2[i], &path);
+    distances[i] = path.length;
+  }
 }
 
 vector<Control> HCpm0_Reeds_Shepp_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> hc_rs_controls;
   hc_rs_controls.reserve(5);
-  HC_CC_RS_Path *p = this->hcpm0_reeds_shepp(state1, state2);
-  switch (p->type)
+  HC_CC_RS_Path_Candidate p;
+  this->hcpm0_reeds_shepp(state1, state2, &p);
+  Configuration start(state1.x, state1.y, state1.theta, 0);
+  switch (p.type)
   {
     case EMPTY:
       empty_controls(hc_rs_controls);
       break;
     case T:
-      hc_turn_controls(*(p->cend), p->start, false, hc_rs_controls);
+      hc_turn_controls(p.cend, start, false, hc_rs_controls);
       break;
     case TT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi1), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi1, false, hc_rs_controls);
       break;
     case TcTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      rs_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      rs_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TcTT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TTcT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TST:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, hc_rs_controls);
       break;
     case TSTcT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi4), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi4), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi4, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi4, false, hc_rs_controls);
       break;
     case TcTST:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, hc_rs_controls);
       break;
     case TcTSTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi4), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi4), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi4, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi4, false, hc_rs_controls);
       break;
     case TTcTT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi2), false, hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi2, false, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, hc_rs_controls);
       break;
     case TcTTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     // ########################################################################
     case TTT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TcST:
     case TScT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      cc_turn_controls(*(p->cend), *(p->qi3), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      cc_turn_controls(p.cend, p.qi3, false, hc_rs_controls);
       break;
     case TcScT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      straight_controls(*(p->qi1), *(p->qi2), hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      straight_controls(p.qi1, p.qi2, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     default:
       break;
   }
-  delete p;
   return hc_rs_controls;
 }
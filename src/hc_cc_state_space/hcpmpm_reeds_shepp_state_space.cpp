@@ -24,17 +24,23 @@
 **********************************************************************/
 
 #include "steering_functions/hc_cc_state_space/hcpmpm_reeds_shepp_state_space.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 
 #define HC_REGULAR false
 #define CC_REGULAR false
+#define PRUNING_EPS 1e-9
+
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+thread_local HCpmpm_Reeds_Shepp_State_Space::Pruning_Counters pruning_counters = { 0, 0 };
+#endif
 
 class HCpmpm_Reeds_Shepp_State_Space::HCpmpm_Reeds_Shepp
 {
 private:
-  HCpmpm_Reeds_Shepp_State_Space *parent_;
+  const HCpmpm_Reeds_Shepp_State_Space *parent_;
 
 public:
-  explicit HCpmpm_Reeds_Shepp(HCpmpm_Reeds_Shepp_State_Space *parent)
+  explicit HCpmpm_Reeds_Shepp(const HCpmpm_Reeds_Shepp_State_Space *parent)
   {
     parent_ = parent;
   }
@@ -56,8 +62,8 @@ public:
     return fabs(distance - 2 * parent_->radius_) < get_epsilon();
   }
 
-  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                 Configuration **q1, Configuration **q2, Configuration **q3)
+  double TT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                 Configuration *q1, Configuration *q2, Configuration *q3)
   {
     double x = (c1.xc + c2.xc) / 2;
     double y = (c1.yc + c2.yc) / 2;
@@ -85,14 +91,14 @@ public:
         theta = angle - HALF_PI - parent_->mu_;
       }
     }
-    *q2 = new Configuration(x, y, theta, 0);
+    *q2 = Configuration(x, y, theta, 0);
     if (cstart && cend && q1 && q3)
     {
-      *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(**q2, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      *q3 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-      return (*cstart)->hc_turn_length(**q1) + (*cend)->hc_turn_length(**q3);
+      *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(*q2, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      *q3 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+      return cstart->hc_turn_length(*q1) + cend->hc_turn_length(*q3);
     }
     return numeric_limits<double>::max();
   }
@@ -111,8 +117,8 @@ public:
     return fabs(distance - fabs(2 / c1.kappa)) < get_epsilon();
   }
 
-  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q)
+  double TcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q)
   {
     double distance = center_distance(c1, c2);
     double delta_x = 0.5 * distance;
@@ -145,12 +151,12 @@ public:
         global_frame_change(c1.xc, c1.yc, angle, delta_x, delta_y, &x, &y);
       }
     }
-    *q = new Configuration(x, y, theta, c1.kappa);
+    *q = Configuration(x, y, theta, c1.kappa);
     if (cstart && cend)
     {
-      *cstart = new HC_CC_Circle(c1);
-      *cend = new HC_CC_Circle(c2);
-      return (*cstart)->rs_turn_length(**q) + (*cend)->rs_turn_length(**q);
+      *cstart = HC_CC_Circle(c1);
+      *cend = HC_CC_Circle(c2);
+      return cstart->rs_turn_length(*q) + cend->rs_turn_length(*q);
     }
     return numeric_limits<double>::max();
   }
@@ -171,8 +177,8 @@ public:
     return distance <= fabs(4 / c1.kappa);
   }
 
-  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4)
+  void TcTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = fabs(2 / c1.kappa);
@@ -191,29 +197,25 @@ public:
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
   }
 
-  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TcTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *middle1, *middle2;
-    middle1 = new HC_CC_Circle(*qa, !c1.left, !c1.forward, true, parent_->rs_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, !c1.forward, true, parent_->rs_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, !c1.forward, true, parent_->rs_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, !c1.forward, true, parent_->rs_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->rs_turn_length(*qb) + (*cend)->rs_turn_length(*qb);
-    double length2 = (*cstart)->rs_turn_length(*qc) + middle2->rs_turn_length(*qd) + (*cend)->rs_turn_length(*qd);
+    double length1 = cstart->rs_turn_length(qa) + middle1.rs_turn_length(qb) + cend->rs_turn_length(qb);
+    double length2 = cstart->rs_turn_length(qc) + middle2.rs_turn_length(qd) + cend->rs_turn_length(qd);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qb;
       *ci = middle1;
-      delete qc;
-      delete qd;
-      delete middle2;
       return length1;
     }
     else
@@ -221,9 +223,6 @@ public:
       *q1 = qc;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -244,8 +243,8 @@ public:
            (distance >= 2 * parent_->radius_ - 2 / fabs(c1.kappa));
   }
 
-  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 / fabs(c1.kappa);
@@ -265,33 +264,27 @@ public:
     TT_path(tgt2, c2, nullptr, nullptr, nullptr, q4, nullptr);
   }
 
-  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *end1, *end2, *middle1, *middle2;
-    end1 = new HC_CC_Circle(*qb, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    end2 = new HC_CC_Circle(*qd, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end1(qb, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end2(qd, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *q2 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *cstart = HC_CC_Circle(c1);
+    *q2 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->hc_turn_length(*qa) + end1->hc_turn_length(**q2);
-    double length2 = (*cstart)->rs_turn_length(*qc) + middle2->hc_turn_length(*qc) + end2->hc_turn_length(**q2);
+    double length1 = cstart->rs_turn_length(qa) + middle1.hc_turn_length(qa) + end1.hc_turn_length(*q2);
+    double length2 = cstart->rs_turn_length(qc) + middle2.hc_turn_length(qc) + end2.hc_turn_length(*q2);
     if (length1 < length2)
     {
       *cend = end1;
       *q1 = qa;
       *ci = middle1;
-      delete qb;
-      delete qc;
-      delete qd;
-      delete end2;
-      delete middle2;
       return length1;
     }
     else
@@ -299,11 +292,6 @@ public:
       *cend = end2;
       *q1 = qc;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete qd;
-      delete end1;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -324,8 +312,8 @@ public:
            (distance >= 2 * parent_->radius_ - 2 / fabs(c1.kappa));
   }
 
-  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                            Configuration **q3, Configuration **q4)
+  void TTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                            Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r1 = 2 * parent_->radius_;
@@ -345,33 +333,27 @@ public:
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
   }
 
-  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, HC_CC_Circle **ci)
+  double TTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *start1, *start2, *middle1, *middle2;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->hc_turn_length(*qb) + (*cend)->rs_turn_length(*qb);
-    double length2 = start2->hc_turn_length(**q1) + middle2->hc_turn_length(*qd) + (*cend)->rs_turn_length(*qd);
+    double length1 = start1.hc_turn_length(*q1) + middle1.hc_turn_length(qb) + cend->rs_turn_length(qb);
+    double length2 = start2.hc_turn_length(*q1) + middle2.hc_turn_length(qd) + cend->rs_turn_length(qd);
     if (length1 < length2)
     {
       *cstart = start1;
       *q2 = qb;
       *ci = middle1;
-      delete qa;
-      delete qc;
-      delete qd;
-      delete start2;
-      delete middle2;
       return length1;
     }
     else
@@ -379,11 +361,6 @@ public:
       *cstart = start2;
       *q2 = qd;
       *ci = middle2;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete start1;
-      delete middle1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -421,8 +398,8 @@ public:
     return TiST_exists(c1, c2) || TeST_exists(c1, c2);
   }
 
-  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double distance = center_distance(c1, c2);
     double angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
@@ -434,47 +411,47 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (cstart && cend && q1 && q4)
     {
-      *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-      return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+      *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+      return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
     }
     return numeric_limits<double>::max();
   }
 
-  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
     double delta_y = fabs(parent_->radius_ * parent_->cos_mu_);
@@ -483,45 +460,45 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
 
     if (cstart && cend && q1 && q4)
     {
-      *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-      *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-      *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-      return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+      *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+      *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+      *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+      return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
     }
     return numeric_limits<double>::max();
   }
 
-  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     if (TiST_exists(c1, c2))
     {
@@ -567,8 +544,8 @@ public:
     return TiSTcT_exists(c1, c2) || TeSTcT_exists(c1, c2);
   }
 
-  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_y = (4 * parent_->radius_ * parent_->cos_mu_) / (fabs(c2.kappa) * distance);
@@ -581,17 +558,17 @@ public:
     TiST_path(c1, tgt1, nullptr, nullptr, nullptr, q2, q3, nullptr);
     TcT_path(tgt1, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *ci = new HC_CC_Circle(**q3, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *ci = HC_CC_Circle(*q3, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*ci)->hc_turn_length(**q4) +
-           (*cend)->rs_turn_length(**q4);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + ci->hc_turn_length(*q4) +
+           cend->rs_turn_length(*q4);
   }
 
-  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c2.kappa);
@@ -604,17 +581,17 @@ public:
     TeST_path(c1, tgt1, nullptr, nullptr, nullptr, q2, q3, nullptr);
     TcT_path(tgt1, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(c2);
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *ci = new HC_CC_Circle(**q3, c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(c2);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *ci = HC_CC_Circle(*q3, c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*ci)->hc_turn_length(**q4) +
-           (*cend)->rs_turn_length(**q4);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + ci->hc_turn_length(*q4) +
+           cend->rs_turn_length(*q4);
   }
 
-  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     if (TiSTcT_exists(c1, c2))
     {
@@ -660,8 +637,8 @@ public:
     return TcTiST_exists(c1, c2) || TcTeST_exists(c1, c2);
   }
 
-  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TcTiST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_y = (4 * c2.radius) / (fabs(c2.kappa) * distance);
@@ -674,17 +651,17 @@ public:
     TcT_path(c1, tgt1, nullptr, nullptr, q1);
     TiST_path(tgt1, c2, nullptr, nullptr, nullptr, q2, q3, nullptr);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *ci = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *ci = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*cend)->hc_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           cend->hc_turn_length(*q4);
   }
 
-  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TcTeST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c2.kappa);
@@ -697,17 +674,17 @@ public:
     TcT_path(c1, tgt1, nullptr, nullptr, q1);
     TeST_path(tgt1, c2, nullptr, nullptr, nullptr, q2, q3, nullptr);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *ci = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *ci = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*cend)->hc_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           cend->hc_turn_length(*q4);
   }
 
-  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4, HC_CC_Circle **ci)
+  double TcTST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4, HC_CC_Circle *ci)
   {
     if (TcTiST_exists(c1, c2))
     {
@@ -753,9 +730,9 @@ public:
     return TcTiSTcT_exists(c1, c2) || TcTeSTcT_exists(c1, c2);
   }
 
-  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                       Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                       HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTiSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                       Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                       HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double delta_y = (4 * parent_->radius_ * parent_->cos_mu_) / (distance * fabs(c1.kappa));
@@ -771,18 +748,18 @@ public:
     TiST_path(tgt1, tgt2, nullptr, nullptr, nullptr, q2, q3, nullptr);
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    *ci1 = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    *ci1 = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci1)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*ci2)->hc_turn_length(**q4) + (*cend)->rs_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci1->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           ci2->hc_turn_length(*q4) + cend->rs_turn_length(*q4);
   }
 
-  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                       Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                       HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTeSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                       Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                       HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     double theta = angle;
     double delta_x = 2 / fabs(c1.kappa);
@@ -798,18 +775,18 @@ public:
     TeST_path(tgt1, tgt2, nullptr, nullptr, nullptr, q2, q3, nullptr);
     TcT_path(tgt2, c2, nullptr, nullptr, q4);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    *ci1 = new HC_CC_Circle(**q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    *ci2 = new HC_CC_Circle(**q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    *ci1 = HC_CC_Circle(*q2, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    *ci2 = HC_CC_Circle(*q3, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
 
-    return (*cstart)->rs_turn_length(**q1) + (*ci1)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) +
-           (*ci2)->hc_turn_length(**q4) + (*cend)->rs_turn_length(**q4);
+    return cstart->rs_turn_length(*q1) + ci1->hc_turn_length(*q1) + configuration_distance(*q2, *q3) +
+           ci2->hc_turn_length(*q4) + cend->rs_turn_length(*q4);
   }
 
-  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                      Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4,
-                      HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTSTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                      Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4,
+                      HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
     if (TcTiSTcT_exists(c1, c2))
     {
@@ -836,8 +813,8 @@ public:
     return (distance <= 4 * parent_->radius_ + 2 / fabs(c1.kappa));
   }
 
-  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                             Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TTcTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                             Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1, r2, delta_x, delta_y, x, y;
@@ -873,29 +850,28 @@ public:
     TT_path(tgt4, c2, nullptr, nullptr, nullptr, q6, nullptr);
   }
 
-  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TTcTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TTcTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *start1, *start2, *end1, *end2, *middle1, *middle2, *middle3, *middle4;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
-    end1 = new HC_CC_Circle(*qc, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qd, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qf, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
-    end2 = new HC_CC_Circle(*qf, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q3 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end1(qc, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qd, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qd, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qf, !c2.left, c2.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end2(qf, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q3 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->hc_turn_length(*qb) + middle2->hc_turn_length(*qb) +
-                     end1->hc_turn_length(**q3);
-    double length2 = start2->hc_turn_length(**q1) + middle3->hc_turn_length(*qe) + middle4->hc_turn_length(*qe) +
-                     end2->hc_turn_length(**q3);
+    double length1 = start1.hc_turn_length(*q1) + middle1.hc_turn_length(qb) + middle2.hc_turn_length(qb) +
+                     end1.hc_turn_length(*q3);
+    double length2 = start2.hc_turn_length(*q1) + middle3.hc_turn_length(qe) + middle4.hc_turn_length(qe) +
+                     end2.hc_turn_length(*q3);
     if (length1 < length2)
     {
       *cstart = start1;
@@ -903,13 +879,6 @@ public:
       *ci1 = middle1;
       *ci2 = middle2;
       *q2 = qb;
-      delete qa;
-      delete qc;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete start2, delete end2, delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -919,15 +888,6 @@ public:
       *ci1 = middle3;
       *ci2 = middle4;
       *q2 = qe;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete qd;
-      delete qf;
-      delete start1;
-      delete end1;
-      delete middle1;
-      delete middle2;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -948,8 +908,8 @@ public:
            (distance >= 4 / fabs(c1.kappa) - 2 * parent_->radius_);
   }
 
-  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                              Configuration **q3, Configuration **q4, Configuration **q5, Configuration **q6)
+  void TcTTcT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                              Configuration *q3, Configuration *q4, Configuration *q5, Configuration *q6)
   {
     double theta = angle;
     double r1 = 2 / fabs(c1.kappa);
@@ -977,37 +937,30 @@ public:
     TcT_path(tgt4, c2, nullptr, nullptr, q6);
   }
 
-  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2, HC_CC_Circle **ci1, HC_CC_Circle **ci2)
+  double TcTTcT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2, HC_CC_Circle *ci1, HC_CC_Circle *ci2)
   {
-    Configuration *qa, *qb, *qc, *qd, *qe, *qf;
+    Configuration qa, qb, qc, qd, qe, qf;
     TcTTcT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd, &qe, &qf);
-    HC_CC_Circle *middle1, *middle2, *middle3, *middle4;
-    middle1 = new HC_CC_Circle(*qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qb, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
-    middle3 = new HC_CC_Circle(*qe, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
-    middle4 = new HC_CC_Circle(*qe, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qb, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qb, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle3(qe, !c1.left, c1.forward, true, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle4(qe, c1.left, !c1.forward, true, parent_->hc_cc_circle_param_);
 
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
 
     // select shortest connection
-    double length1 = (*cstart)->rs_turn_length(*qa) + middle1->hc_turn_length(*qa) + middle2->hc_turn_length(*qc) +
-                     (*cend)->rs_turn_length(*qc);
-    double length2 = (*cstart)->rs_turn_length(*qd) + middle3->hc_turn_length(*qd) + middle4->hc_turn_length(*qf) +
-                     (*cend)->rs_turn_length(*qf);
+    double length1 = cstart->rs_turn_length(qa) + middle1.hc_turn_length(qa) + middle2.hc_turn_length(qc) +
+                     cend->rs_turn_length(qc);
+    double length2 = cstart->rs_turn_length(qd) + middle3.hc_turn_length(qd) + middle4.hc_turn_length(qf) +
+                     cend->rs_turn_length(qf);
     if (length1 < length2)
     {
       *q1 = qa;
       *q2 = qc;
       *ci1 = middle1;
       *ci2 = middle2;
-      delete qb;
-      delete qd;
-      delete qe;
-      delete qf;
-      delete middle3;
-      delete middle4;
       return length1;
     }
     else
@@ -1016,12 +969,6 @@ public:
       *q2 = qf;
       *ci1 = middle3;
       *ci2 = middle4;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete qe;
-      delete middle1;
-      delete middle2;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -1043,8 +990,8 @@ public:
     return distance <= 4 * parent_->radius_;
   }
 
-  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration **q1, Configuration **q2,
-                           Configuration **q3, Configuration **q4)
+  void TTT_tangent_circles(const HC_CC_Circle &c1, const HC_CC_Circle &c2, Configuration *q1, Configuration *q2,
+                           Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double r = 2 * parent_->radius_;
@@ -1063,37 +1010,30 @@ public:
     TT_path(tgt2, c2, nullptr, nullptr, nullptr, q4, nullptr);
   }
 
-  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                  Configuration **q1, Configuration **q2, Configuration **q3, HC_CC_Circle **ci)
+  double TTT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                  Configuration *q1, Configuration *q2, Configuration *q3, HC_CC_Circle *ci)
   {
-    Configuration *qa, *qb, *qc, *qd;
+    Configuration qa, qb, qc, qd;
     TTT_tangent_circles(c1, c2, &qa, &qb, &qc, &qd);
-    HC_CC_Circle *start1, *start2, *end1, *end2, *middle1, *middle2;
-    start1 = new HC_CC_Circle(*qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle1 = new HC_CC_Circle(*qa, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    end1 = new HC_CC_Circle(*qb, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    start2 = new HC_CC_Circle(*qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    middle2 = new HC_CC_Circle(*qc, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
-    end2 = new HC_CC_Circle(*qd, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start1(qa, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle1(qa, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end1(qb, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle start2(qc, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle middle2(qc, !c1.left, c1.forward, CC_REGULAR, parent_->hc_cc_circle_param_);
+    HC_CC_Circle end2(qd, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
 
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q3 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q3 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
 
     // select shortest connection
-    double length1 = start1->hc_turn_length(**q1) + middle1->cc_turn_length(*qb) + end1->hc_turn_length(**q3);
-    double length2 = start2->hc_turn_length(**q1) + middle2->cc_turn_length(*qd) + end2->hc_turn_length(**q3);
+    double length1 = start1.hc_turn_length(*q1) + middle1.cc_turn_length(qb) + end1.hc_turn_length(*q3);
+    double length2 = start2.hc_turn_length(*q1) + middle2.cc_turn_length(qd) + end2.hc_turn_length(*q3);
     if (length1 < length2)
     {
       *cstart = start1;
       *ci = middle1;
       *cend = end1;
       *q2 = qb;
-      delete qa;
-      delete qc;
-      delete qd;
-      delete start2;
-      delete middle2;
-      delete end2;
       return length1;
     }
     else
@@ -1102,12 +1042,6 @@ public:
       *ci = middle2;
       *cend = end2;
       *q2 = qd;
-      delete qa;
-      delete qb;
-      delete qc;
-      delete start1;
-      delete middle1;
-      delete end1;
       return length2;
     }
     return numeric_limits<double>::max();
@@ -1145,8 +1079,8 @@ public:
     return TciST_exists(c1, c2) || TceST_exists(c1, c2);
   }
 
-  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TciST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double alpha = fabs(asin(2 * parent_->radius_ * parent_->cos_mu_ / distance));
     double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
@@ -1156,43 +1090,43 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
   }
 
-  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TceST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
@@ -1201,40 +1135,40 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, -delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
   }
 
-  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TcST_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     if (TciST_exists(c1, c2))
     {
@@ -1279,8 +1213,8 @@ public:
     return TiScT_exists(c1, c2) || TeScT_exists(c1, c2);
   }
 
-  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TiScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double alpha = fabs(asin(2 * parent_->radius_ * parent_->cos_mu_ / distance));
     double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
@@ -1290,43 +1224,43 @@ public:
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
   }
 
-  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TeScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     double theta = angle;
     double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
@@ -1335,40 +1269,40 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, 0);
+      *q2 = Configuration(x, y, theta, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta, 0);
+      *q3 = Configuration(x, y, theta, 0);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, 0);
+      *q2 = Configuration(x, y, theta + PI, 0);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q3 = new Configuration(x, y, theta + PI, 0);
+      *q3 = Configuration(x, y, theta + PI, 0);
     }
-    *q1 = new Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
-    *q4 = new Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
-    *cstart = new HC_CC_Circle(**q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    *cend = new HC_CC_Circle(**q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
-    return (*cstart)->hc_turn_length(**q1) + configuration_distance(**q2, **q3) + (*cend)->hc_turn_length(**q4);
+    *q1 = Configuration(c1.start.x, c1.start.y, c1.start.theta, c1.kappa);
+    *q4 = Configuration(c2.start.x, c2.start.y, c2.start.theta, c2.kappa);
+    *cstart = HC_CC_Circle(*q2, c1.left, !c1.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    *cend = HC_CC_Circle(*q3, c2.left, !c2.forward, HC_REGULAR, parent_->hc_cc_circle_param_);
+    return cstart->hc_turn_length(*q1) + configuration_distance(*q2, *q3) + cend->hc_turn_length(*q4);
   }
 
-  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                   Configuration **q1, Configuration **q2, Configuration **q3, Configuration **q4)
+  double TScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                   Configuration *q1, Configuration *q2, Configuration *q3, Configuration *q4)
   {
     if (TiScT_exists(c1, c2))
     {
@@ -1413,8 +1347,8 @@ public:
     return TciScT_exists(c1, c2) || TceScT_exists(c1, c2);
   }
 
-  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2)
+  double TciScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2)
   {
     double alpha = fabs(asin(2 / (c1.kappa * distance)));
     double delta_x = 0.0;
@@ -1424,41 +1358,41 @@ public:
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (c1.left && !c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
     if (!c1.left && c1.forward)
     {
       theta = angle + alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (!c1.left && !c1.forward)
     {
       theta = angle - alpha;
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    return (*cstart)->rs_turn_length(**q1) + configuration_distance(**q1, **q2) + (*cend)->rs_turn_length(**q2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    return cstart->rs_turn_length(*q1) + configuration_distance(*q1, *q2) + cend->rs_turn_length(*q2);
   }
 
-  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                     Configuration **q1, Configuration **q2)
+  double TceScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                     Configuration *q1, Configuration *q2)
   {
     double theta = angle;
     double delta_x = 0.0;
@@ -1467,38 +1401,38 @@ public:
     if (c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
     if (!c1.left && c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, -delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta + PI, c1.kappa);
+      *q1 = Configuration(x, y, theta + PI, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, -delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta + PI, c2.kappa);
+      *q2 = Configuration(x, y, theta + PI, c2.kappa);
     }
     if (!c1.left && !c1.forward)
     {
       global_frame_change(c1.xc, c1.yc, theta, -delta_x, delta_y, &x, &y);
-      *q1 = new Configuration(x, y, theta, c1.kappa);
+      *q1 = Configuration(x, y, theta, c1.kappa);
       global_frame_change(c2.xc, c2.yc, theta, delta_x, delta_y, &x, &y);
-      *q2 = new Configuration(x, y, theta, c2.kappa);
+      *q2 = Configuration(x, y, theta, c2.kappa);
     }
-    *cstart = new HC_CC_Circle(c1);
-    *cend = new HC_CC_Circle(c2);
-    return (*cstart)->rs_turn_length(**q1) + configuration_distance(**q1, **q2) + (*cend)->rs_turn_length(**q2);
+    *cstart = HC_CC_Circle(c1);
+    *cend = HC_CC_Circle(c2);
+    return cstart->rs_turn_length(*q1) + configuration_distance(*q1, *q2) + cend->rs_turn_length(*q2);
   }
 
-  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle **cstart, HC_CC_Circle **cend,
-                    Configuration **q1, Configuration **q2)
+  double TcScT_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_Circle *cstart, HC_CC_Circle *cend,
+                    Configuration *q1, Configuration *q2)
   {
     if (TciScT_exists(c1, c2))
     {
@@ -1510,13 +1444,226 @@ public:
     }
     return numeric_limits<double>::max();
   }
+
+  // ##### Dispatch #############################################################
+  bool exists(hc_cc_rs_path_type type, const HC_CC_Circle &c1, const HC_CC_Circle &c2)
+  {
+    switch (type)
+    {
+      case TT:
+        return TT_exists(c1, c2);
+      case TcT:
+        return TcT_exists(c1, c2);
+      case TcTcT:
+        return TcTcT_exists(c1, c2);
+      case TcTT:
+        return TcTT_exists(c1, c2);
+      case TTcT:
+        return TTcT_exists(c1, c2);
+      case TST:
+        return TST_exists(c1, c2);
+      case TSTcT:
+        return TSTcT_exists(c1, c2);
+      case TcTST:
+        return TcTST_exists(c1, c2);
+      case TcTSTcT:
+        return TcTSTcT_exists(c1, c2);
+      case TTcTT:
+        return TTcTT_exists(c1, c2);
+      case TcTTcT:
+        return TcTTcT_exists(c1, c2);
+      case TTT:
+        return TTT_exists(c1, c2);
+      case TcST:
+        return TcST_exists(c1, c2);
+      case TScT:
+        return TScT_exists(c1, c2);
+      case TcScT:
+        return TcScT_exists(c1, c2);
+      default:
+        return false;
+    }
+  }
+
+  void path(hc_cc_rs_path_type type, const HC_CC_Circle &c1, const HC_CC_Circle &c2, HC_CC_RS_Path_Candidate *p)
+  {
+    p->reset(type);
+    switch (type)
+    {
+      case TT:
+        p->length = TT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot());
+        break;
+      case TcT:
+        p->length = TcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot());
+        break;
+      case TcTcT:
+        p->length = TcTcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->ci1_slot());
+        break;
+      case TcTT:
+        p->length = TcTT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->ci1_slot());
+        break;
+      case TTcT:
+        p->length = TTcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->ci1_slot());
+        break;
+      case TST:
+        p->length = TST_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                             p->qi4_slot());
+        break;
+      case TSTcT:
+        p->length = TSTcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                               p->qi4_slot(), p->ci1_slot());
+        break;
+      case TcTST:
+        p->length = TcTST_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                               p->qi4_slot(), p->ci1_slot());
+        break;
+      case TcTSTcT:
+        p->length = TcTSTcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(),
+                                 p->qi3_slot(), p->qi4_slot(), p->ci1_slot(), p->ci2_slot());
+        break;
+      case TTcTT:
+        p->length = TTcTT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                               p->ci1_slot(), p->ci2_slot());
+        break;
+      case TcTTcT:
+        p->length = TcTTcT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->ci1_slot(),
+                                p->ci2_slot());
+        break;
+      case TTT:
+        p->length = TTT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                             p->ci1_slot());
+        break;
+      case TcST:
+        p->length = TcST_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                              p->qi4_slot());
+        break;
+      case TScT:
+        p->length = TScT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot(), p->qi3_slot(),
+                              p->qi4_slot());
+        break;
+      case TcScT:
+        p->length = TcScT_path(c1, c2, p->cstart_slot(), p->cend_slot(), p->qi1_slot(), p->qi2_slot());
+        break;
+      default:
+        break;
+    }
+  }
+
+  // ##### Lower bounds #########################################################
+  /* The length of an hc-turn (resp. rs-turn) is at least |dtheta| / kappa + kappa / (2 * sigma) (resp. |dtheta| /
+     kappa), where |dtheta| <= pi is the heading change of the turn modulo 2 pi, which follows from the turn lengths
+     in HC_CC_Circle for regular and irregular turns. The families with a straight line tangent to c1 and c2 are
+     bounded by the heading of the straight line, which is computed as in their path functions, and the length of the
+     straight line. The remaining families are bounded by the sum of the heading changes and the triangle inequality
+     for the straight line, whose end points lie at distance radius_ from the centers of c1 and c2 or of intermediate
+     circles 2 / kappa away from them (cusps). The Euclidean distance between the start and the goal is not used: it
+     bounds all families alike and never exceeds the length of a path found so far, so it cannot prune a family. */
+  double heading_change(double theta1, double theta2) const
+  {
+    double delta = theta2 - theta1;
+    delta = fabs(delta - TWO_PI * static_cast<long>(delta / TWO_PI));
+    return delta > PI ? TWO_PI - delta : delta;
+  }
+
+  double tangent_bound(const HC_CC_Circle &c1, const HC_CC_Circle &c2, double theta, double straight, int nb_hc)
+  {
+    double kappa = parent_->kappa_, sigma = parent_->sigma_;
+    return (heading_change(c1.start.theta, theta) + heading_change(theta, c2.start.theta)) / kappa +
+           nb_hc * kappa / (2 * sigma) + straight;
+  }
+
+  double lower_bound(hc_cc_rs_path_type type, const HC_CC_Circle &c1, const HC_CC_Circle &c2)
+  {
+    double kappa = parent_->kappa_, sigma = parent_->sigma_;
+    double delta_x = fabs(parent_->radius_ * parent_->sin_mu_);
+    double delta_y = fabs(parent_->radius_ * parent_->cos_mu_);
+    double bound, alpha, theta, inner;
+    switch (type)
+    {
+      case TST:
+        if (TiST_exists(c1, c2))
+        {
+          alpha = fabs(asin(2 * delta_y / distance));
+          inner = sqrt(max(distance * distance - 4 * delta_y * delta_y, 0.0));
+          theta = angle + (c1.left == c1.forward ? alpha : -alpha) + (c1.forward ? 0 : PI);
+          bound = tangent_bound(c1, c2, theta, fabs(inner - 2 * delta_x), 2);
+        }
+        else
+        {
+          theta = angle + (c1.forward ? 0 : PI);
+          bound = tangent_bound(c1, c2, theta, fabs(distance - 2 * delta_x), 2);
+        }
+        break;
+      case TcST:
+        if (TciST_exists(c1, c2))
+        {
+          alpha = fabs(asin(2 * delta_y / distance));
+          inner = sqrt(max(distance * distance - 4 * delta_y * delta_y, 0.0));
+          theta = angle + (c1.left == c1.forward ? -alpha : alpha) + (c1.forward ? PI : 0);
+          bound = tangent_bound(c1, c2, theta, inner, 2);
+        }
+        else
+        {
+          theta = angle + (c1.forward ? PI : 0);
+          bound = tangent_bound(c1, c2, theta, distance, 2);
+        }
+        break;
+      case TScT:
+        if (TiScT_exists(c1, c2))
+        {
+          alpha = fabs(asin(2 * delta_y / distance));
+          inner = sqrt(max(distance * distance - 4 * delta_y * delta_y, 0.0));
+          theta = angle + (c1.left == c1.forward ? alpha : -alpha) + (c1.forward ? 0 : PI);
+          bound = tangent_bound(c1, c2, theta, inner, 2);
+        }
+        else
+        {
+          theta = angle + (c1.forward ? 0 : PI);
+          bound = tangent_bound(c1, c2, theta, distance, 2);
+        }
+        break;
+      case TcScT:
+        if (TciScT_exists(c1, c2))
+        {
+          alpha = fabs(asin(2 / (c1.kappa * distance)));
+          inner = sqrt(max(distance * distance - 4 / (c1.kappa * c1.kappa), 0.0));
+          theta = angle + (c1.left == c1.forward ? -alpha : alpha) + (c1.forward ? PI : 0);
+          bound = tangent_bound(c1, c2, theta, inner, 0);
+        }
+        else
+        {
+          theta = angle + (c1.forward ? PI : 0);
+          bound = tangent_bound(c1, c2, theta, distance, 0);
+        }
+        break;
+      case TTT:
+        // the heading change of the cc-turn is not bounded
+        bound = 2 * kappa / sigma;
+        break;
+      default:
+      {
+        int nb_hc = (type == TcT || type == TcTcT) ? 0 : ((type == TTcTT) ? 4 : 2);
+        double cusp = fabs(2 / c1.kappa);
+        double straight = 0;
+        if (type == TSTcT || type == TcTST)
+          straight = max(distance - 2 * parent_->radius_ - cusp, 0.0);
+        else if (type == TcTSTcT)
+          straight = max(distance - 2 * parent_->radius_ - 2 * cusp, 0.0);
+        bound = max(heading_change(c1.start.theta, c2.start.theta) / kappa + nb_hc * kappa / (2 * sigma),
+                    nb_hc * kappa / sigma) +
+                straight;
+      }
+    }
+    // margin for rounding errors
+    return bound - PRUNING_EPS * (1 + bound);
+  }
 };
 
 // ############################################################################
 
-HCpmpm_Reeds_Shepp_State_Space::HCpmpm_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization)
-  : HC_CC_State_Space(kappa, sigma, discretization)
-  , hcpmpm_reeds_shepp_{ unique_ptr<HCpmpm_Reeds_Shepp>(new HCpmpm_Reeds_Shepp(this)) }
+HCpmpm_Reeds_Shepp_State_Space::HCpmpm_Reeds_Shepp_State_Space(double kappa, double sigma, double discretization,
+                                                               bool pruning)
+  : HC_CC_State_Space(kappa, sigma, discretization), pruning_(pruning)
 {
   rs_circle_param_.set_param(kappa_, numeric_limits<double>::max(), 1 / kappa_, 0.0, 0.0, 1.0, 0.0);
   radius_ = hc_cc_circle_param_.radius;
@@ -1527,189 +1674,81 @@ HCpmpm_Reeds_Shepp_State_Space::HCpmpm_Reeds_Shepp_State_Space(double kappa, dou
 
 HCpmpm_Reeds_Shepp_State_Space::~HCpmpm_Reeds_Shepp_State_Space() = default;
 
-HC_CC_RS_Path *HCpmpm_Reeds_Shepp_State_Space::hcpmpm_circles_rs_path(const HC_CC_Circle &c1,
-                                                                      const HC_CC_Circle &c2) const
+void HCpmpm_Reeds_Shepp_State_Space::hcpmpm_circles_rs_path(const HC_CC_Circle &c1, const HC_CC_Circle &c2,
+                                                            HC_CC_RS_Path_Candidate *path) const
 {
-  // table containing the lengths of the paths, the intermediate configurations and circles
-  double length[nb_hc_cc_rs_paths];
-  double_array_init(length, nb_hc_cc_rs_paths, numeric_limits<double>::max());
-  Configuration *qi1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi1, nb_hc_cc_rs_paths);
-  Configuration *qi2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi2, nb_hc_cc_rs_paths);
-  Configuration *qi3[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi3, nb_hc_cc_rs_paths);
-  Configuration *qi4[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)qi4, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cstart[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cstart, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci1[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci1, nb_hc_cc_rs_paths);
-  HC_CC_Circle *ci2[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)ci2, nb_hc_cc_rs_paths);
-  HC_CC_Circle *cend[nb_hc_cc_rs_paths];
-  pointer_array_init((void **)cend, nb_hc_cc_rs_paths);
+  // slot of the family under evaluation, the shortest family is kept in path
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
+
+  // families and precomputations of this query, a per-call instance keeps the state space reentrant
+  HCpmpm_Reeds_Shepp families(this);
 
   // precomputations
-  hcpmpm_reeds_shepp_->distance = center_distance(c1, c2);
-  hcpmpm_reeds_shepp_->angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
+  families.distance = center_distance(c1, c2);
+  families.angle = atan2(c2.yc - c1.yc, c2.xc - c1.xc);
 
   // case Empty
   if (configuration_equal(c1.start, c2.start))
   {
-    length[EMPTY] = 0;
-    goto label_end;
+    path->length = 0;
+    return;
   }
   // case T
   if (configuration_on_hc_cc_circle(c1, c2.start))
   {
-    cstart[T] = new HC_CC_Circle(c1.start, c1.left, c1.forward, false, rs_circle_param_);
-    length[T] = cstart[T]->rs_turn_length(c2.start);
-    goto label_end;
-  }
-  // case TT
-  if (hcpmpm_reeds_shepp_->TT_exists(c1, c2))
-  {
-    length[TT] = hcpmpm_reeds_shepp_->TT_path(c1, c2, &cstart[TT], &cend[TT], &qi1[TT], &qi2[TT], &qi3[TT]);
+    path->reset(T);
+    *path->cstart_slot() = HC_CC_Circle(c1.start, c1.left, c1.forward, false, rs_circle_param_);
+    path->length = path->cstart.rs_turn_length(c2.start);
+    return;
   }
-  // case TcT
-  if (hcpmpm_reeds_shepp_->TcT_exists(c1, c2))
+  // cases TT, TcT, the Reeds-Shepp families and TTT, TcST, TScT, TcScT
+  for (int i = TT; i <= TcScT; i++)
   {
-    length[TcT] = hcpmpm_reeds_shepp_->TcT_path(c1, c2, &cstart[TcT], &cend[TcT], &qi1[TcT]);
-  }
-  // ##### Reeds-Shepp families: ############################################
-  // case TcTcT
-  if (hcpmpm_reeds_shepp_->TcTcT_exists(c1, c2))
-  {
-    length[TcTcT] =
-        hcpmpm_reeds_shepp_->TcTcT_path(c1, c2, &cstart[TcTcT], &cend[TcTcT], &qi1[TcTcT], &qi2[TcTcT], &ci1[TcTcT]);
-  }
-  // case TcTT
-  if (hcpmpm_reeds_shepp_->TcTT_exists(c1, c2))
-  {
-    length[TcTT] =
-        hcpmpm_reeds_shepp_->TcTT_path(c1, c2, &cstart[TcTT], &cend[TcTT], &qi1[TcTT], &qi2[TcTT], &ci1[TcTT]);
-  }
-  // case TTcT
-  if (hcpmpm_reeds_shepp_->TTcT_exists(c1, c2))
-  {
-    length[TTcT] =
-        hcpmpm_reeds_shepp_->TTcT_path(c1, c2, &cstart[TTcT], &cend[TTcT], &qi1[TTcT], &qi2[TTcT], &ci1[TTcT]);
-  }
-  // case TST
-  if (hcpmpm_reeds_shepp_->TST_exists(c1, c2))
-  {
-    length[TST] =
-        hcpmpm_reeds_shepp_->TST_path(c1, c2, &cstart[TST], &cend[TST], &qi1[TST], &qi2[TST], &qi3[TST], &qi4[TST]);
-  }
-  // case TSTcT
-  if (hcpmpm_reeds_shepp_->TSTcT_exists(c1, c2))
-  {
-    length[TSTcT] = hcpmpm_reeds_shepp_->TSTcT_path(c1, c2, &cstart[TSTcT], &cend[TSTcT], &qi1[TSTcT], &qi2[TSTcT],
-                                                    &qi3[TSTcT], &qi4[TSTcT], &ci1[TSTcT]);
-  }
-  // case TcTST
-  if (hcpmpm_reeds_shepp_->TcTST_exists(c1, c2))
-  {
-    length[TcTST] = hcpmpm_reeds_shepp_->TcTST_path(c1, c2, &cstart[TcTST], &cend[TcTST], &qi1[TcTST], &qi2[TcTST],
-                                                    &qi3[TcTST], &qi4[TcTST], &ci1[TcTST]);
-  }
-  // case TcTSTcT
-  if (hcpmpm_reeds_shepp_->TcTSTcT_exists(c1, c2))
-  {
-    length[TcTSTcT] =
-        hcpmpm_reeds_shepp_->TcTSTcT_path(c1, c2, &cstart[TcTSTcT], &cend[TcTSTcT], &qi1[TcTSTcT], &qi2[TcTSTcT],
-                                          &qi3[TcTSTcT], &qi4[TcTSTcT], &ci1[TcTSTcT], &ci2[TcTSTcT]);
-  }
-  // case TTcTT
-  if (hcpmpm_reeds_shepp_->TTcTT_exists(c1, c2))
-  {
-    length[TTcTT] = hcpmpm_reeds_shepp_->TTcTT_path(c1, c2, &cstart[TTcTT], &cend[TTcTT], &qi1[TTcTT], &qi2[TTcTT],
-                                                    &qi3[TTcTT], &ci1[TTcTT], &ci2[TTcTT]);
-  }
-  // case TcTTcT
-  if (hcpmpm_reeds_shepp_->TcTTcT_exists(c1, c2))
-  {
-    length[TcTTcT] = hcpmpm_reeds_shepp_->TcTTcT_path(c1, c2, &cstart[TcTTcT], &cend[TcTTcT], &qi1[TcTTcT],
-                                                      &qi2[TcTTcT], &ci1[TcTTcT], &ci2[TcTTcT]);
-  }
-  //  ############################################################################
-  // case TTT
-  if (hcpmpm_reeds_shepp_->TTT_exists(c1, c2))
-  {
-    length[TTT] =
-        hcpmpm_reeds_shepp_->TTT_path(c1, c2, &cstart[TTT], &cend[TTT], &qi1[TTT], &qi2[TTT], &qi3[TTT], &ci1[TTT]);
-  }
-  // case TcST
-  if (hcpmpm_reeds_shepp_->TcST_exists(c1, c2))
-  {
-    length[TcST] = hcpmpm_reeds_shepp_->TcST_path(c1, c2, &cstart[TcST], &cend[TcST], &qi1[TcST], &qi2[TcST],
-                                                  &qi3[TcST], &qi4[TcST]);
-  }
-  // case TScT
-  if (hcpmpm_reeds_shepp_->TScT_exists(c1, c2))
-  {
-    length[TScT] = hcpmpm_reeds_shepp_->TScT_path(c1, c2, &cstart[TScT], &cend[TScT], &qi1[TScT], &qi2[TScT],
-                                                  &qi3[TScT], &qi4[TScT]);
-  }
-  // case TcScT
-  if (hcpmpm_reeds_shepp_->TcScT_exists(c1, c2))
-  {
-    length[TcScT] = hcpmpm_reeds_shepp_->TcScT_path(c1, c2, &cstart[TcScT], &cend[TcScT], &qi1[TcScT], &qi2[TcScT]);
-  }
-label_end:
-  // select shortest path
-  hc_cc_rs_path_type best_path = (hc_cc_rs_path_type)array_index_min(length, nb_hc_cc_rs_paths);
-  HC_CC_RS_Path *path;
-  path = new HC_CC_RS_Path(c1.start, c2.start, best_path, kappa_, sigma_, qi1[best_path], qi2[best_path],
-                           qi3[best_path], qi4[best_path], cstart[best_path], cend[best_path], ci1[best_path],
-                           ci2[best_path], length[best_path]);
-
-  // clean up
-  for (int i = 0; i < nb_hc_cc_rs_paths; i++)
-  {
-    if (i != best_path)
+    hc_cc_rs_path_type type = hc_cc_rs_path_type(i);
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPMPM_REEDS_SHEPP, type);
+    if (families.exists(type, c1, c2))
     {
-      delete qi1[i];
-      delete qi2[i];
-      delete qi3[i];
-      delete qi4[i];
-      delete cstart[i];
-      delete ci1[i];
-      delete ci2[i];
-      delete cend[i];
+      INSTRUMENTATION_FAMILY_HIT(type);
+      families.path(type, c1, c2, &candidate);
+      path->assign_if_shorter(candidate);
     }
+    INSTRUMENTATION_FAMILY_END(type);
   }
-  return path;
 }
 
-HC_CC_RS_Path *HCpmpm_Reeds_Shepp_State_Space::hcpmpm_reeds_shepp(const State &state1, const State &state2) const
+HC_CC_RS_Path *HCpmpm_Reeds_Shepp_State_Space::hcpmpm_circles_rs_path(const HC_CC_Circle &c1,
+                                                                      const HC_CC_Circle &c2) const
 {
-  // compute the 4 circles at the intial and final configuration
+  HC_CC_RS_Path_Candidate path;
+  hcpmpm_circles_rs_path(c1, c2, &path);
+  return path.materialize(c1.start, c2.start, kappa_, sigma_);
+}
+
+void HCpmpm_Reeds_Shepp_State_Space::hcpmpm_start_circles(const State &state1, HC_CC_Circle *start_circle) const
+{
+  // compute the 4 circles at the initial configuration
   Configuration start(state1.x, state1.y, state1.theta, state1.kappa);
+  start_circle[0] = HC_CC_Circle(start, true, true, true, rs_circle_param_);
+  start_circle[1] = HC_CC_Circle(start, false, true, true, rs_circle_param_);
+  start_circle[2] = HC_CC_Circle(start, true, false, true, rs_circle_param_);
+  start_circle[3] = HC_CC_Circle(start, false, false, true, rs_circle_param_);
+}
+
+void HCpmpm_Reeds_Shepp_State_Space::hcpmpm_reeds_shepp(const State &state1, const HC_CC_Circle *start_circle,
+                                                        const State &state2, HC_CC_RS_Path_Candidate *path) const
+{
+  // compute the 4 circles at the final configuration
   Configuration end(state2.x, state2.y, state2.theta, state2.kappa);
 
-  HC_CC_Circle *start_circle[4];
-  HC_CC_Circle *end_circle[4];
-  start_circle[0] = new HC_CC_Circle(start, true, true, true, rs_circle_param_);
-  start_circle[1] = new HC_CC_Circle(start, false, true, true, rs_circle_param_);
-  start_circle[2] = new HC_CC_Circle(start, true, false, true, rs_circle_param_);
-  start_circle[3] = new HC_CC_Circle(start, false, false, true, rs_circle_param_);
-  end_circle[0] = new HC_CC_Circle(end, true, true, true, rs_circle_param_);
-  end_circle[1] = new HC_CC_Circle(end, false, true, true, rs_circle_param_);
-  end_circle[2] = new HC_CC_Circle(end, true, false, true, rs_circle_param_);
-  end_circle[3] = new HC_CC_Circle(end, false, false, true, rs_circle_param_);
-
-  // compute the shortest path for the 16 combinations (4 circles at the beginning and 4 at the end)
-  HC_CC_RS_Path *path[] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
-
-  double lg[] = { numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max(), numeric_limits<double>::max(), numeric_limits<double>::max(),
-                  numeric_limits<double>::max() };
+  HC_CC_Circle end_circle[] = { HC_CC_Circle(end, true, true, true, rs_circle_param_),
+                                HC_CC_Circle(end, false, true, true, rs_circle_param_),
+                                HC_CC_Circle(end, true, false, true, rs_circle_param_),
+                                HC_CC_Circle(end, false, false, true, rs_circle_param_) };
+
+  // collect the combinations of the 4 circles at the beginning and 4 at the end
+  const HC_CC_Circle *c1[16], *c2[16];
+  int nb_pairs = 0;
 
   // skip circle at the beginning for curvature continuity
   for (int i = 0; i < 4; i++)
@@ -1733,148 +1772,309 @@ HC_CC_RS_Path *HCpmpm_Reeds_Shepp_State_Space::hcpmpm_reeds_shepp(const State &s
         continue;
       else if (j == 3 && state2.kappa > 0)
         continue;
-      path[4 * i + j] = hcpmpm_circles_rs_path(*start_circle[i], *end_circle[j]);
-      if (path[4 * i + j])
-      {
-        lg[4 * i + j] = path[4 * i + j]->length;
-      }
+      c1[nb_pairs] = &start_circle[i];
+      c2[nb_pairs] = &end_circle[j];
+      nb_pairs++;
     }
   }
 
-  // select shortest path
-  int best_path = array_index_min(lg, 16);
+  if (pruning_)
+  {
+    hcpmpm_pruned_reeds_shepp(c1, c2, nb_pairs, path);
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_HCPMPM_REEDS_SHEPP, path->type);
+    return;
+  }
 
-  //  // display calculations
-  //  cout << "HCpmpm_Reeds_Shepp_State_Space" << endl;
-  //  for (int i = 0; i < 16; i++)
-  //  {
-  //    cout << i << ": ";
-  //    if (path[i])
-  //    {
-  //      path[i]->print(true);
-  //      cout << endl;
-  //    }
-  //  }
-  //  cout << "shortest path: " << (int)best_path << endl;
-  //  path[best_path]->print(true);
+  // compute the shortest path for the combinations
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
+  for (int k = 0; k < nb_pairs; k++)
+  {
+    // select shortest path
+    hcpmpm_circles_rs_path(*c1[k], *c2[k], &candidate);
+    path->assign_if_shorter(candidate);
+  }
+  INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_HCPMPM_REEDS_SHEPP, path->type);
+}
 
-  // clean up
-  for (int i = 0; i < 4; i++)
+void HCpmpm_Reeds_Shepp_State_Space::hcpmpm_pruned_reeds_shepp(const HC_CC_Circle *const *c1,
+                                                               const HC_CC_Circle *const *c2, int nb_pairs,
+                                                               HC_CC_RS_Path_Candidate *path) const
+{
+  const int nb_families = TcScT - TT + 1;
+  // families of a circle pair in ascending order of their lower bounds
+  struct Pair_Families
+  {
+    double distance, angle;
+    int size;
+    hc_cc_rs_path_type type[nb_families];
+    double bound[nb_families];
+  } pairs[16];
+  int order[16];
+
+  HCpmpm_Reeds_Shepp families(this);
+  HC_CC_RS_Path_Candidate candidate;
+  path->reset(EMPTY);
+  // rank of the path in the order of the exhaustive evaluation (pair, then family), equal lengths are resolved in
+  // favor of the lower rank; the empty path wins all ties as in assign_if_shorter
+  int path_rank = -1;
+
+  for (int k = 0; k < nb_pairs; k++)
+  {
+    Pair_Families &pair = pairs[k];
+    pair.distance = center_distance(*c1[k], *c2[k]);
+    pair.angle = atan2(c2[k]->yc - c1[k]->yc, c2[k]->xc - c1[k]->xc);
+    pair.size = 0;
+    order[k] = k;
+    families.distance = pair.distance;
+    families.angle = pair.angle;
+    // cases Empty and T, the families are not evaluated
+    if (configuration_equal(c1[k]->start, c2[k]->start) || configuration_on_hc_cc_circle(*c1[k], c2[k]->start))
+    {
+      pair.type[0] = EMPTY;
+      pair.bound[0] = 0;
+      pair.size = 1;
+      continue;
+    }
+    for (int i = TT; i <= TcScT; i++)
+    {
+      hc_cc_rs_path_type type = hc_cc_rs_path_type(i);
+      INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_HCPMPM_REEDS_SHEPP, type);
+      if (!families.exists(type, *c1[k], *c2[k]))
+      {
+        INSTRUMENTATION_FAMILY_END(type);
+        continue;
+      }
+      INSTRUMENTATION_FAMILY_HIT(type);
+      // insertion after the families with lower or equal bound
+      double bound = families.lower_bound(type, *c1[k], *c2[k]);
+      INSTRUMENTATION_FAMILY_END(type);
+      int l = pair.size++;
+      for (; l > 0 && pair.bound[l - 1] > bound; l--)
+      {
+        pair.type[l] = pair.type[l - 1];
+        pair.bound[l] = pair.bound[l - 1];
+      }
+      pair.type[l] = type;
+      pair.bound[l] = bound;
+    }
+  }
+  // pairs in ascending order of their lowest bound, pairs without families last
+  for (int k = 1; k < nb_pairs; k++)
   {
-    delete start_circle[i];
-    delete end_circle[i];
+    int pair = order[k], l = k;
+    double bound = pairs[pair].size ? pairs[pair].bound[0] : numeric_limits<double>::infinity();
+    for (; l > 0; l--)
+    {
+      const Pair_Families &other = pairs[order[l - 1]];
+      if ((other.size ? other.bound[0] : numeric_limits<double>::infinity()) <= bound)
+        break;
+      order[l] = order[l - 1];
+    }
+    order[l] = pair;
   }
-  for (int i = 0; i < 16; i++)
+
+  for (int k = 0; k < nb_pairs; k++)
   {
-    if (i != best_path)
+    int index = order[k];
+    const Pair_Families &pair = pairs[index];
+    const HC_CC_Circle &start_circle = *c1[index];
+    const HC_CC_Circle &end_circle = *c2[index];
+    families.distance = pair.distance;
+    families.angle = pair.angle;
+    for (int i = 0; i < pair.size; i++)
     {
-      delete path[i];
+      if (pair.bound[i] > path->length)
+      {
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+        pruning_counters.nb_pruned_families += pair.size - i;
+#endif
+        break;
+      }
+      hc_cc_rs_path_type type = pair.type[i];
+      if (type == EMPTY)
+      {
+        // case Empty
+        if (configuration_equal(start_circle.start, end_circle.start))
+        {
+          candidate.reset(EMPTY);
+          candidate.length = 0;
+        }
+        // case T
+        else
+        {
+          candidate.reset(T);
+          *candidate.cstart_slot() =
+              HC_CC_Circle(start_circle.start, start_circle.left, start_circle.forward, false, rs_circle_param_);
+          candidate.length = candidate.cstart.rs_turn_length(end_circle.start);
+        }
+      }
+      else
+      {
+        INSTRUMENTATION_FAMILY_RESUME(INSTRUMENTED_HCPMPM_REEDS_SHEPP, type);
+        families.path(type, start_circle, end_circle, &candidate);
+        INSTRUMENTATION_FAMILY_END(type);
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+        pruning_counters.nb_evaluated_families++;
+#endif
+      }
+      int rank = index * nb_hc_cc_rs_paths + candidate.type;
+      if (candidate.length < path->length || (candidate.length == path->length && rank < path_rank))
+      {
+        *path = candidate;
+        path_rank = rank;
+      }
     }
   }
-  return path[best_path];
+}
+
+void HCpmpm_Reeds_Shepp_State_Space::hcpmpm_reeds_shepp(const State &state1, const State &state2,
+                                                        HC_CC_RS_Path_Candidate *path) const
+{
+  HC_CC_Circle start_circle[4];
+  hcpmpm_start_circles(state1, start_circle);
+  hcpmpm_reeds_shepp(state1, start_circle, state2, path);
+}
+
+HC_CC_RS_Path *HCpmpm_Reeds_Shepp_State_Space::hcpmpm_reeds_shepp(const State &state1, const State &state2) const
+{
+  HC_CC_RS_Path_Candidate path;
+  hcpmpm_reeds_shepp(state1, state2, &path);
+  Configuration start(state1.x, state1.y, state1.theta, 0);
+  Configuration end(state2.x, state2.y, state2.theta, 0);
+  return path.materialize(start, end, kappa_, sigma_);
 }
 
 double HCpmpm_Reeds_Shepp_State_Space::get_distance(const State &state1, const State &state2) const
 {
-  HC_CC_RS_Path *p = this->hcpmpm_reeds_shepp(state1, state2);
-  double length = p->length;
-  delete p;
-  return length;
+  HC_CC_RS_Path_Candidate path;
+  this->hcpmpm_reeds_shepp(state1, state2, &path);
+  return path.length;
+}
+
+void HCpmpm_Reeds_Shepp_State_Space::get_distances(const State &state1, const State *states2, size_t n,
+                                                   double *distances) const
+{
+  HC_CC_Circle start_circle[4];
+  hcpmpm_start_circles(state1, start_circle);
+  HC_CC_RS_Path_Candidate path;
+  for (size_t i = 0; i < n; i++)
+  {
+    hcpmpm_reeds_shepp(state1, start_circle, states2[i], &path);
+    distances[i] = path.length;
+  }
+}
+
+HCpmpm_Reeds_Shepp_State_Space::Pruning_Counters HCpmpm_Reeds_Shepp_State_Space::get_pruning_counters()
+{
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  return pruning_counters;
+#else
+  Pruning_Counters counters = { 0, 0 };
+  return counters;
+#endif
+}
+
+void HCpmpm_Reeds_Shepp_State_Space::reset_pruning_counters()
+{
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  pruning_counters = { 0, 0 };
+#endif
 }
 
 vector<Control> HCpmpm_Reeds_Shepp_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> hc_rs_controls;
-  hc_rs_controls.reserve(5);
-  HC_CC_RS_Path *p = this->hcpmpm_reeds_shepp(state1, state2);
-  switch (p->type)
+  hc_rs_controls.reserve(8);
+  HC_CC_RS_Path_Candidate p;
+  this->hcpmpm_reeds_shepp(state1, state2, &p);
+  switch (p.type)
   {
     case EMPTY:
       empty_controls(hc_rs_controls);
       break;
     case T:
-      rs_turn_controls(*(p->cstart), p->end, true, hc_rs_controls);
+      rs_turn_controls(p.cstart, Configuration(state2.x, state2.y, state2.theta, 0), true, hc_rs_controls);
       break;
     case TT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi3), true, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi3, true, hc_rs_controls);
       break;
     case TcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi1), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi1, false, hc_rs_controls);
       break;
     // ##### Reeds-Shepp families: ############################################
     case TcTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      rs_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      rs_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TcTT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi2), true, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi2, true, hc_rs_controls);
       break;
     case TTcT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     case TST:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi4), true, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi4, true, hc_rs_controls);
       break;
     case TSTcT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi4), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi4), false, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi4, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi4, false, hc_rs_controls);
       break;
     case TcTST:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi4), true, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi4, true, hc_rs_controls);
       break;
     case TcTSTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi4), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi4), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi4, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi4, false, hc_rs_controls);
       break;
     case TTcTT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi2), false, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi3), true, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi2, false, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi3, true, hc_rs_controls);
       break;
     case TcTTcT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      hc_turn_controls(*(p->ci1), *(p->qi1), false, hc_rs_controls);
-      hc_turn_controls(*(p->ci2), *(p->qi2), true, hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      hc_turn_controls(p.ci1, p.qi1, false, hc_rs_controls);
+      hc_turn_controls(p.ci2, p.qi2, true, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     // ########################################################################
     case TTT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      cc_turn_controls(*(p->ci1), *(p->qi2), true, hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi3), true, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      cc_turn_controls(p.ci1, p.qi2, true, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi3, true, hc_rs_controls);
       break;
     case TcST:
     case TScT:
-      hc_turn_controls(*(p->cstart), *(p->qi1), false, hc_rs_controls);
-      straight_controls(*(p->qi2), *(p->qi3), hc_rs_controls);
-      hc_turn_controls(*(p->cend), *(p->qi4), true, hc_rs_controls);
+      hc_turn_controls(p.cstart, p.qi1, false, hc_rs_controls);
+      straight_controls(p.qi2, p.qi3, hc_rs_controls);
+      hc_turn_controls(p.cend, p.qi4, true, hc_rs_controls);
       break;
     case TcScT:
-      rs_turn_controls(*(p->cstart), *(p->qi1), true, hc_rs_controls);
-      straight_controls(*(p->qi1), *(p->qi2), hc_rs_controls);
-      rs_turn_controls(*(p->cend), *(p->qi2), false, hc_rs_controls);
+      rs_turn_controls(p.cstart, p.qi1, true, hc_rs_controls);
+      straight_controls(p.qi1, p.qi2, hc_rs_controls);
+      rs_turn_controls(p.cend, p.qi2, false, hc_rs_controls);
       break;
     default:
       break;
   }
-  delete p;
   return hc_rs_controls;
 }
@@ -147,6 +147,67 @@ void CC_Dubins_Path::print(bool eol) const
   }
 }
 
+CC_Dubins_Path_Candidate::CC_Dubins_Path_Candidate()
+{
+  reset(E);
+}
+
+void CC_Dubins_Path_Candidate::reset(cc_dubins_path_type _type)
+{
+  type = _type;
+  length = numeric_limits<double>::max();
+  has_qi1_ = false;
+  has_qi2_ = false;
+  has_cstart_ = false;
+  has_cend_ = false;
+  has_ci1_ = false;
+}
+
+void CC_Dubins_Path_Candidate::assign_if_shorter(const CC_Dubins_Path_Candidate &other)
+{
+  if (other.length < length || (other.length == length && other.type < type))
+    *this = other;
+}
+
+Configuration *CC_Dubins_Path_Candidate::qi1_slot()
+{
+  has_qi1_ = true;
+  return &qi1;
+}
+
+Configuration *CC_Dubins_Path_Candidate::qi2_slot()
+{
+  has_qi2_ = true;
+  return &qi2;
+}
+
+HC_CC_Circle *CC_Dubins_Path_Candidate::cstart_slot()
+{
+  has_cstart_ = true;
+  return &cstart;
+}
+
+HC_CC_Circle *CC_Dubins_Path_Candidate::cend_slot()
+{
+  has_cend_ = true;
+  return &cend;
+}
+
+HC_CC_Circle *CC_Dubins_Path_Candidate::ci1_slot()
+{
+  has_ci1_ = true;
+  return &ci1;
+}
+
+CC_Dubins_Path *CC_Dubins_Path_Candidate::materialize(double _kappa, double _sigma) const
+{
+  return new CC_Dubins_Path(start, end, type, _kappa, _sigma, has_qi1_ ? new Configuration(qi1) : nullptr,
+                            has_qi2_ ? new Configuration(qi2) : nullptr,
+                            has_cstart_ ? new HC_CC_Circle(cstart) : nullptr,
+                            has_cend_ ? new HC_CC_Circle(cend) : nullptr, has_ci1_ ? new HC_CC_Circle(ci1) : nullptr,
+                            length);
+}
+
 HC_CC_RS_Path::HC_CC_RS_Path(const Configuration &_start, const Configuration &_end, hc_cc_rs_path_type _type,
                              double _kappa, double _sigma, Configuration *_qi1, Configuration *_qi2,
                              Configuration *_qi3, Configuration *_qi4, HC_CC_Circle *_cstart, HC_CC_Circle *_cend,
@@ -273,6 +334,90 @@ void HC_CC_RS_Path::print(bool eol) const
   }
 }
 
+HC_CC_RS_Path_Candidate::HC_CC_RS_Path_Candidate()
+{
+  reset(EMPTY);
+}
+
+void HC_CC_RS_Path_Candidate::reset(hc_cc_rs_path_type _type)
+{
+  type = _type;
+  length = numeric_limits<double>::max();
+  has_qi1_ = false;
+  has_qi2_ = false;
+  has_qi3_ = false;
+  has_qi4_ = false;
+  has_cstart_ = false;
+  has_cend_ = false;
+  has_ci1_ = false;
+  has_ci2_ = false;
+}
+
+void HC_CC_RS_Path_Candidate::assign_if_shorter(const HC_CC_RS_Path_Candidate &other)
+{
+  if (other.length < length)
+    *this = other;
+}
+
+Configuration *HC_CC_RS_Path_Candidate::qi1_slot()
+{
+  has_qi1_ = true;
+  return &qi1;
+}
+
+Configuration *HC_CC_RS_Path_Candidate::qi2_slot()
+{
+  has_qi2_ = true;
+  return &qi2;
+}
+
+Configuration *HC_CC_RS_Path_Candidate::qi3_slot()
+{
+  has_qi3_ = true;
+  return &qi3;
+}
+
+Configuration *HC_CC_RS_Path_Candidate::qi4_slot()
+{
+  has_qi4_ = true;
+  return &qi4;
+}
+
+HC_CC_Circle *HC_CC_RS_Path_Candidate::cstart_slot()
+{
+  has_cstart_ = true;
+  return &cstart;
+}
+
+HC_CC_Circle *HC_CC_RS_Path_Candidate::cend_slot()
+{
+  has_cend_ = true;
+  return &cend;
+}
+
+HC_CC_Circle *HC_CC_RS_Path_Candidate::ci1_slot()
+{
+  has_ci1_ = true;
+  return &ci1;
+}
+
+HC_CC_Circle *HC_CC_RS_Path_Candidate::ci2_slot()
+{
+  has_ci2_ = true;
+  return &ci2;
+}
+
+HC_CC_RS_Path *HC_CC_RS_Path_Candidate::materialize(const Configuration &_start, const Configuration &_end,
+                                                    double _kappa, double _sigma) const
+{
+  return new HC_CC_RS_Path(_start, _end, type, _kappa, _sigma, has_qi1_ ? new Configuration(qi1) : nullptr,
+                           has_qi2_ ? new Configuration(qi2) : nullptr, has_qi3_ ? new Configuration(qi3) : nullptr,
+                           has_qi4_ ? new Configuration(qi4) : nullptr,
+                           has_cstart_ ? new HC_CC_Circle(cstart) : nullptr,
+                           has_cend_ ? new HC_CC_Circle(cend) : nullptr, has_ci1_ ? new HC_CC_Circle(ci1) : nullptr,
+                           has_ci2_ ? new HC_CC_Circle(ci2) : nullptr, length);
+}
+
 void empty_controls(vector<Control> &controls)
 {
   Control control;
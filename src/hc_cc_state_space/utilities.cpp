@@ -24,6 +24,13 @@
 **********************************************************************/
 
 #include "steering_functions/hc_cc_state_space/utilities.hpp"
+#include "steering_functions/hc_cc_state_space/fresnel_batch.hpp"
+
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 double get_epsilon()
 {
@@ -95,40 +102,198 @@ float approxCos(const float x)
   return 1. + x_2 * (first_term + x_2 * (second_term + x_2 * (third_term + x_2 * fourth_term)));
 }
 
-double fresnel(double x, bool fresnelc)
+namespace
 {
-  if (fabs(x) > Fresnel_Length)
+struct Fresnel_Expansions
+{
+  // coefficients of C and S in each interval, highest degree first
+  double coeffs[fresnel_batch::nb_intervals][fresnel_batch::degree + 1][2];
+};
+
+// Taylor coefficients a[n] of w(x0 + h) = exp(i * pi/2 * (x0 + h)^2) = sum(a[n] * h^n), the differential equation
+// w' = i * pi * x * w gives (n + 1) * a[n + 1] = i * pi * (x0 * a[n] + a[n - 1])
+template <typename T>
+void fresnel_derivative_coeffs(T x0, int size, T *re, T *im)
+{
+  const T pi = 3.14159265358979323846264338327950288L;
+  re[0] = cos(pi / 2 * x0 * x0);
+  im[0] = sin(pi / 2 * x0 * x0);
+  for (int n = 0; n + 1 < size; n++)
   {
-    cerr << "Fresnel integral out of range" << endl;
-    return 0;
+    T prev_re = (n > 0) ? re[n - 1] : 0;
+    T prev_im = (n > 0) ? im[n - 1] : 0;
+    re[n + 1] = -pi * (x0 * im[n] + prev_im) / (n + 1);
+    im[n + 1] = pi * (x0 * re[n] + prev_re) / (n + 1);
   }
-  int sign = sgn(x);
-  double diter = fabs(x) / Fresnel_Length * Fresnel_Samples;
-  int iter = (int)diter;
-  double rest = diter - iter;
-  double inf, sup;
-  if (fresnelc)
+}
+
+// C and S are evaluated with Taylor expansions around the centers of equally spaced intervals on [0, 4[ and with the
+// asymptotic expansion beyond
+Fresnel_Expansions compute_fresnel_expansions()
+{
+  using namespace fresnel_batch;
+  // the values at the centers are integrated from interval to interval in extended precision
+  const int nb_terms = 30;
+  long double re[nb_terms], im[nb_terms];
+  long double c_center = 0, s_center = 0;
+  long double x_center = 0, step = 0.5L / intervals_per_unit;
+  Fresnel_Expansions expansions;
+  for (int k = 0; k < nb_intervals; k++)
   {
-    inf = FresnelC[iter];
-    sup = FresnelC[iter + 1];
+    fresnel_derivative_coeffs(x_center, nb_terms, re, im);
+    long double step_n = step;
+    for (int n = 0; n < nb_terms; n++)
+    {
+      c_center += re[n] * step_n / (n + 1);
+      s_center += im[n] * step_n / (n + 1);
+      step_n *= step;
+    }
+    x_center += step;
+    step = 1.0L / intervals_per_unit;
+
+    double x0 = static_cast<double>(x_center), re_x0[degree], im_x0[degree];
+    fresnel_derivative_coeffs(x0, degree, re_x0, im_x0);
+    expansions.coeffs[k][degree][0] = static_cast<double>(c_center);
+    expansions.coeffs[k][degree][1] = static_cast<double>(s_center);
+    for (int n = 0; n < degree; n++)
+    {
+      expansions.coeffs[k][degree - 1 - n][0] = re_x0[n] / (n + 1);
+      expansions.coeffs[k][degree - 1 - n][1] = im_x0[n] / (n + 1);
+    }
   }
-  else
+  return expansions;
+}
+
+// coefficients of the rational approximations of the auxiliary functions f and g of the asymptotic expansion, taken
+// from the Cephes library (fresnl.c)
+const double fresnel_fn[10] = { 4.21543555043677546506E-1,  1.43407919780758885261E-1,  1.15220955073585758835E-2,
+                                3.45017939782574027900E-4,  4.63613749287867322088E-6,  3.05568983790257605827E-8,
+                                1.02304514164907233465E-10, 1.72010743268161828879E-13, 1.34283276233062758925E-16,
+                                3.76329711269987889006E-20 };
+const double fresnel_fd[10] = { 7.51586398353378947175E-1,  1.16888925859191382142E-1,  6.44051526508858611005E-3,
+                                1.55934409164153020873E-4,  1.84627567348930545870E-6,  1.12699224763999035261E-8,
+                                3.60140029589371370404E-11, 5.88754533621578410010E-14, 4.52001434074129701496E-17,
+                                1.25443237090011264384E-20 };
+const double fresnel_gn[11] = { 5.04442073643383265887E-1,  1.97102833525523411709E-1,  1.87648584092575249293E-2,
+                                6.84079380915393090172E-4,  1.15138826111884280931E-5,  9.82852443688422223854E-8,
+                                4.45344415861750144738E-10, 1.08268041139020870318E-12, 1.37555460633261799868E-15,
+                                8.36354435630677421531E-19, 1.86958710162783235106E-22 };
+const double fresnel_gd[11] = { 1.47495759925128324529E0,   3.37748989120019970451E-1,  2.53603741420338795122E-2,
+                                8.14679107184306179049E-4,  1.27545075667729118702E-5,  1.04314589657571990585E-7,
+                                4.60680728146520428211E-10, 1.10273215066240270757E-12, 1.38796531259578871258E-15,
+                                8.39158816283118707363E-19, 1.86958710162783236342E-22 };
+
+// evaluation of the polynomial coeffs[0] * x^n + ... + coeffs[n]
+double polynomial(double x, const double coeffs[], int n)
+{
+  double result = coeffs[0];
+  for (int i = 1; i <= n; i++)
+    result = result * x + coeffs[i];
+  return result;
+}
+
+// evaluation of the polynomial x^n + coeffs[0] * x^(n-1) + ... + coeffs[n-1]
+double monic_polynomial(double x, const double coeffs[], int n)
+{
+  double result = x + coeffs[0];
+  for (int i = 1; i < n; i++)
+    result = result * x + coeffs[i];
+  return result;
+}
+
+void fresnel_cs_asymptotic(double x, double *c, double *s)
+{
+  if (x > 36974.0)
   {
-    inf = FresnelS[iter];
-    sup = FresnelS[iter + 1];
+    *c = 0.5;
+    *s = 0.5;
+    return;
   }
-  // interpolation
-  return (sign * ((1 - rest) * inf + rest * sup));
+  double x2 = x * x;
+  double t = PI * x2;
+  double u = 1 / (t * t);
+  t = 1 / t;
+  double f = 1 - u * polynomial(u, fresnel_fn, 9) / monic_polynomial(u, fresnel_fd, 10);
+  double g = t * polynomial(u, fresnel_gn, 10) / monic_polynomial(u, fresnel_gd, 11);
+  double sin_t = sin(HALF_PI * x2);
+  double cos_t = cos(HALF_PI * x2);
+  t = PI * x;
+  *c = 0.5 + (f * sin_t - g * cos_t) / t;
+  *s = 0.5 - (f * cos_t + g * sin_t) / t;
+}
+}
+
+const double *fresnel_batch::get_expansions()
+{
+  static const Fresnel_Expansions expansions = compute_fresnel_expansions();
+  return &expansions.coeffs[0][0][0];
+}
+
+void fresnel_cs(double x, double *c, double *s)
+{
+  using namespace fresnel_batch;
+  double ux = fabs(x);
+  double cc, ss;
+  if (ux < nb_intervals / static_cast<double>(intervals_per_unit))
+  {
+    int k = static_cast<int>(ux * intervals_per_unit);
+    double h = ux - (k + 0.5) / intervals_per_unit;
+    const double *coeffs = get_expansions() + 2 * k * (degree + 1);
+#ifdef __SSE2__
+    // C and S are evaluated in the two lanes of a single Horner scheme
+    __m128d h_2 = _mm_set1_pd(h);
+    __m128d result = _mm_loadu_pd(coeffs);
+    for (int i = 1; i <= degree; i++)
+      result = _mm_add_pd(_mm_mul_pd(result, h_2), _mm_loadu_pd(coeffs + 2 * i));
+    cc = _mm_cvtsd_f64(result);
+    ss = _mm_cvtsd_f64(_mm_unpackhi_pd(result, result));
+#else
+    cc = coeffs[0];
+    ss = coeffs[1];
+    for (int i = 1; i <= degree; i++)
+    {
+      cc = cc * h + coeffs[2 * i];
+      ss = ss * h + coeffs[2 * i + 1];
+    }
+#endif
+  }
+  else
+    fresnel_cs_asymptotic(ux, &cc, &ss);
+  // C and S are odd functions
+  *c = copysign(cc, x);
+  *s = copysign(ss, x);
+}
+
+void fresnel_cs(const double *x, double *c, double *s, size_t n)
+{
+  // the CPU is queried once
+  static const fresnel_batch::Fresnel_Function batch_fresnel_cs = []() -> fresnel_batch::Fresnel_Function {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (fresnel_batch::avx2_fresnel_cs && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return fresnel_batch::avx2_fresnel_cs;
+#endif
+    return nullptr;
+  }();
+  if (batch_fresnel_cs)
+    batch_fresnel_cs(x, c, s, n);
+  else
+    for (size_t i = 0; i < n; i++)
+      fresnel_cs(x[i], c + i, s + i);
 }
 
 double fresnelc(double s)
 {
-  return fresnel(s, true);
+  double c_s, s_s;
+  fresnel_cs(s, &c_s, &s_s);
+  return c_s;
 }
 
 double fresnels(double s)
 {
-  return fresnel(s, false);
+  double c_s, s_s;
+  fresnel_cs(s, &c_s, &s_s);
+  return s_s;
 }
 
 void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, double sigma, bool forward, double length,
@@ -173,10 +338,15 @@ void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, dou
     double k1 = 0.5 * pow(ukappa, 2) / usigma;
     double k2 = (usigma * length + ssigma * skappa * ukappa) / sqrt(PI * usigma);
     double k3 = ukappa / sqrt(PI * usigma);
-    x = sqrt(PI / usigma) * (cos(k1) * fresnelc(k2) + sin(k1) * fresnels(k2) -
-                             ssigma * skappa * cos(k1) * fresnelc(k3) - ssigma * skappa * sin(k1) * fresnels(k3));
-    y = sqrt(PI / usigma) * (ssigma * cos(k1) * fresnels(k2) - ssigma * sin(k1) * fresnelc(k2) -
-                             skappa * cos(k1) * fresnels(k3) + skappa * sin(k1) * fresnelc(k3));
+    double fresnelc_k2, fresnels_k2, fresnelc_k3, fresnels_k3;
+    fresnel_cs(k2, &fresnelc_k2, &fresnels_k2);
+    fresnel_cs(k3, &fresnelc_k3, &fresnels_k3);
+    double cos_k1 = cos(k1);
+    double sin_k1 = sin(k1);
+    x = sqrt(PI / usigma) * (cos_k1 * fresnelc_k2 + sin_k1 * fresnels_k2 - ssigma * skappa * cos_k1 * fresnelc_k3 -
+                             ssigma * skappa * sin_k1 * fresnels_k3);
+    y = sqrt(PI / usigma) * (ssigma * cos_k1 * fresnels_k2 - ssigma * sin_k1 * fresnelc_k2 -
+                             skappa * cos_k1 * fresnels_k3 + skappa * sin_k1 * fresnelc_k3);
     x = d * x;
     theta = d * theta;
   }
@@ -187,6 +357,59 @@ void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, dou
   *kappa_f = kappa;
 }
 
+void end_of_clothoid(double x_i, double y_i, double theta_i, double kappa_i, double sigma, bool forward,
+                     const double *lengths, size_t n, double *x_f, double *y_f, double *theta_f, double *kappa_f)
+{
+  if (fabs(sigma) < get_epsilon())
+  {
+    for (size_t i = 0; i < n; i++)
+      end_of_clothoid(x_i, y_i, theta_i, kappa_i, sigma, forward, lengths[i], x_f + i, y_f + i, theta_f + i,
+                      kappa_f + i);
+    return;
+  }
+  double d = forward ? 1 : -1;
+  // the terms that do not depend on the length are computed once, the expressions are the same as above
+  int ssigma = sgn(sigma);
+  double usigma = fabs(sigma);
+  int skappa = sgn(kappa_i);
+  double ukappa = fabs(kappa_i);
+  double k1 = 0.5 * pow(ukappa, 2) / usigma;
+  double k3 = ukappa / sqrt(PI * usigma);
+  double fresnelc_k3, fresnels_k3;
+  fresnel_cs(k3, &fresnelc_k3, &fresnels_k3);
+  double cos_k1 = cos(k1);
+  double sin_k1 = sin(k1);
+  double sin_th = sin(theta_i);
+  double cos_th = cos(theta_i);
+
+  // the Fresnel integrals of k2 are evaluated in blocks on the stack
+  const size_t block_size = 256;
+  double k2[block_size], fresnelc_k2[block_size], fresnels_k2[block_size];
+  for (size_t i = 0; i < n; i += block_size)
+  {
+    size_t m = min(block_size, n - i);
+    for (size_t j = 0; j < m; j++)
+      k2[j] = (usigma * lengths[i + j] + ssigma * skappa * ukappa) / sqrt(PI * usigma);
+    fresnel_cs(k2, fresnelc_k2, fresnels_k2, m);
+    for (size_t j = 0; j < m; j++)
+    {
+      double length = lengths[i + j];
+      double kappa = kappa_i + sigma * length;
+      double theta = 0.5 * sigma * pow(length, 2) + kappa_i * length;
+      double x = sqrt(PI / usigma) * (cos_k1 * fresnelc_k2[j] + sin_k1 * fresnels_k2[j] -
+                                      ssigma * skappa * cos_k1 * fresnelc_k3 - ssigma * skappa * sin_k1 * fresnels_k3);
+      double y = sqrt(PI / usigma) * (ssigma * cos_k1 * fresnels_k2[j] - ssigma * sin_k1 * fresnelc_k2[j] -
+                                      skappa * cos_k1 * fresnels_k3 + skappa * sin_k1 * fresnelc_k3);
+      x = d * x;
+      theta = d * theta;
+      x_f[i + j] = x * cos_th - y * sin_th + x_i;
+      y_f[i + j] = x * sin_th + y * cos_th + y_i;
+      theta_f[i + j] = twopify(theta_i + theta);
+      kappa_f[i + j] = kappa;
+    }
+  }
+}
+
 void end_of_circular_arc(double x_i, double y_i, double theta_i, double kappa, bool forward, double length, double *x_f,
                          double *y_f, double *theta_f)
 {
@@ -236,7 +459,9 @@ void local_frame_change(double x, double y, double theta, double global_x, doubl
 
 double D1(double alpha)
 {
-  return cos(alpha) * fresnelc(sqrt(2 * alpha / PI)) + sin(alpha) * fresnels(sqrt(2 * alpha / PI));
+  double fresnelc_alpha, fresnels_alpha;
+  fresnel_cs(sqrt(2 * alpha / PI), &fresnelc_alpha, &fresnels_alpha);
+  return cos(alpha) * fresnelc_alpha + sin(alpha) * fresnels_alpha;
 }
 
 int array_index_min(double array[], int size)
@@ -0,0 +1,399 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include "steering_functions/heuristic_table/heuristic_table.hpp"
+
+namespace
+{
+const double twopi = 2. * M_PI;
+
+// rounds a path length to a float that does not exceed it
+float round_down(double value)
+{
+  float rounded = static_cast<float>(value);
+  if (rounded > value)
+    rounded = nextafter(rounded, -numeric_limits<float>::infinity());
+  return rounded;
+}
+
+// samples the path lengths from start to the goals (x0 + i * step, x0 + j * step, theta), i, j < nb_samples
+void sample_slice(const Distance_Matrix &distance_matrix, const Distance_Matrix::Distance_Function &distance,
+                  const State &start, const State &goal, double x0, double step, int nb_samples, double theta,
+                  vector<State> &goals, vector<double> &distances)
+{
+  goals.resize(static_cast<size_t>(nb_samples) * nb_samples);
+  distances.resize(goals.size());
+  for (int j = 0; j < nb_samples; j++)
+  {
+    for (int i = 0; i < nb_samples; i++)
+    {
+      State &state = goals[static_cast<size_t>(j) * nb_samples + i];
+      state = goal;
+      state.x = x0 + i * step;
+      state.y = x0 + j * step;
+      state.theta = theta;
+    }
+  }
+  distance_matrix.compute(distance, &start, 1, goals.data(), goals.size(), distances.data());
+}
+
+// binary file: the header is followed by the values as floats in native byte order, the header is a multiple of 64
+// bytes so that the mapped values are aligned
+const char file_magic[8] = { 'S', 'F', 'H', 'T', 'A', 'B', 'L', 'E' };
+const uint32_t file_version = 1;
+const uint32_t file_byte_order = 0x01020304;
+
+struct File_Header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  char state_space[32];
+  double kappa, sigma;
+  double start_kappa, start_d, goal_kappa, goal_d;
+  double extent, resolution;
+  int32_t nb_theta, mode, nb_subsamples, nb_cells;
+  int32_t nb_x, nb_y, nb_theta_values, reserved;
+  double origin, max_error;
+  uint64_t nb_values;
+  // FNV-1a hash of the header (with checksum = 0) and the values
+  uint64_t checksum;
+  char padding[16];
+};
+static_assert(sizeof(File_Header) % 64 == 0, "the values of the table must be aligned");
+
+uint64_t fnv1a(const void *data, size_t size, uint64_t hash = 14695981039346656037ull)
+{
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  for (size_t n = 0; n < size; n++)
+    hash = (hash ^ bytes[n]) * 1099511628211ull;
+  return hash;
+}
+
+uint64_t checksum(const File_Header &header, const float *values)
+{
+  File_Header copy = header;
+  copy.checksum = 0;
+  return fnv1a(values, header.nb_values * sizeof(float), fnv1a(&copy, sizeof(copy)));
+}
+
+// writes size bytes to the file descriptor, returns false on an error
+bool write_all(int fd, const void *data, size_t size)
+{
+  const char *bytes = static_cast<const char *>(data);
+  while (size > 0)
+  {
+    ssize_t written = write(fd, bytes, size);
+    if (written < 0 && errno == EINTR)
+      continue;
+    if (written <= 0)
+      return false;
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+// number of cells in x and y of a grid that is centered at the start and covers at least [-extent, extent]
+int get_nb_cells(double extent, double resolution)
+{
+  return max(static_cast<int>(ceil(2 * extent / resolution - 1e-9)), 1);
+}
+}
+
+Heuristic_Table::Heuristic_Table()
+  : parameters_(), nb_cells_(0), nb_x_(0), nb_y_(0), nb_theta_(0), origin_(0.0), max_error_(0.0), start_(), goal_(),
+    nb_values_(0)
+{
+}
+
+void Heuristic_Table::build(const Distance_Matrix::Distance_Function &distance, const Parameters &parameters,
+                            const State &start, const State &goal, unsigned int nb_threads)
+{
+  parameters_ = parameters;
+  parameters_.nb_theta = max(parameters.nb_theta, 1);
+  parameters_.nb_subsamples = max(parameters.nb_subsamples, 1);
+  nb_cells_ = get_nb_cells(parameters.extent, parameters.resolution);
+  origin_ = -0.5 * nb_cells_ * parameters.resolution;
+  nb_theta_ = parameters_.nb_theta;
+  max_error_ = 0.0;
+  start_ = start;
+  start_.x = start_.y = start_.theta = 0.0;
+  goal_ = goal;
+  goal_.x = goal_.y = goal_.theta = 0.0;
+
+  shared_ptr<vector<float>> values = make_shared<vector<float>>();
+  Distance_Matrix distance_matrix(nb_threads);
+  if (parameters_.mode == HEURISTIC_INTERPOLATED)
+    sample_vertices(distance_matrix, distance, *values);
+  else
+    sample_cells(distance_matrix, distance, *values);
+  nb_values_ = values->size();
+  values_ = shared_ptr<const float>(values, values->data());
+}
+
+void Heuristic_Table::sample_vertices(const Distance_Matrix &distance_matrix,
+                                      const Distance_Matrix::Distance_Function &distance, vector<float> &values)
+{
+  vector<State> goals;
+  vector<double> distances;
+  nb_x_ = nb_y_ = nb_cells_ + 1;
+  values.resize(static_cast<size_t>(nb_x_) * nb_y_ * nb_theta_);
+  for (int k = 0; k < nb_theta_; k++)
+  {
+    sample_slice(distance_matrix, distance, start_, goal_, origin_, parameters_.resolution, nb_x_,
+                 k * twopi / nb_theta_, goals, distances);
+    for (size_t n = 0; n < distances.size(); n++)
+      values[index(0, 0, k) + n] = static_cast<float>(distances[n]);
+  }
+  // range of the vertices of each cell
+  for (int k = 0; k < nb_theta_; k++)
+    for (int j = 0; j < nb_cells_; j++)
+      for (int i = 0; i < nb_cells_; i++)
+      {
+        float lower = numeric_limits<float>::infinity(), upper = -numeric_limits<float>::infinity();
+        for (int c = 0; c < 8; c++)
+        {
+          float value = values[index(i + (c & 1), j + ((c >> 1) & 1), (k + (c >> 2)) % nb_theta_)];
+          lower = min(lower, value);
+          upper = max(upper, value);
+        }
+        max_error_ = max(max_error_, static_cast<double>(upper - lower));
+      }
+}
+
+void Heuristic_Table::sample_cells(const Distance_Matrix &distance_matrix,
+                                   const Distance_Matrix::Distance_Function &distance, vector<float> &values)
+{
+  // each cell is subsampled on a grid of nb_subsamples + 1 samples per dimension (the samples on the faces are
+  // shared with the adjacent cells), the slices of the fine grid are evaluated one after another
+  vector<State> goals;
+  vector<double> distances;
+  int s = parameters_.nb_subsamples, nb_samples = nb_cells_ * s + 1;
+  nb_x_ = nb_y_ = nb_cells_;
+  values.resize(static_cast<size_t>(nb_x_) * nb_y_ * nb_theta_);
+  vector<double> lower(values.size(), numeric_limits<double>::infinity());
+  vector<double> upper(values.size(), -numeric_limits<double>::infinity());
+  for (int f = 0; f < nb_theta_ * s; f++)
+  {
+    sample_slice(distance_matrix, distance, start_, goal_, origin_, parameters_.resolution / s, nb_samples,
+                 f * twopi / (nb_theta_ * s), goals, distances);
+    // the slice lies within theta cell f / s and, on the boundary, also within the previous cell
+    int k_begin = (f % s == 0) ? f / s - 1 : f / s, k_end = f / s;
+    for (int j = 0; j < nb_cells_; j++)
+      for (int i = 0; i < nb_cells_; i++)
+      {
+        double slice_lower = numeric_limits<double>::infinity(), slice_upper = -numeric_limits<double>::infinity();
+        for (int b = j * s; b <= (j + 1) * s; b++)
+          for (int a = i * s; a <= (i + 1) * s; a++)
+          {
+            double value = distances[static_cast<size_t>(b) * nb_samples + a];
+            slice_lower = min(slice_lower, value);
+            slice_upper = max(slice_upper, value);
+          }
+        for (int k = k_begin; k <= k_end; k++)
+        {
+          size_t n = index(i, j, (k + nb_theta_) % nb_theta_);
+          lower[n] = min(lower[n], slice_lower);
+          upper[n] = max(upper[n], slice_upper);
+        }
+      }
+  }
+  for (size_t n = 0; n < values.size(); n++)
+  {
+    values[n] = round_down(lower[n]);
+    max_error_ = max(max_error_, upper[n] - values[n]);
+  }
+}
+
+double Heuristic_Table::get_distance(const State &state1, const State &state2) const
+{
+  double c = cos(state1.theta), s = sin(state1.theta);
+  double dx = state2.x - state1.x, dy = state2.y - state1.y;
+  return get_distance(c * dx + s * dy, -s * dx + c * dy, state2.theta - state1.theta);
+}
+
+double Heuristic_Table::get_distance(double dx, double dy, double dtheta) const
+{
+  if (!values_ || !contains(dx, dy) || !std::isfinite(dtheta))
+    return sqrt(dx * dx + dy * dy);
+  double u = (dx - origin_) / parameters_.resolution;
+  double v = (dy - origin_) / parameters_.resolution;
+  double w = fmod(dtheta, twopi);
+  if (w < 0)
+    w += twopi;
+  w *= nb_theta_ / twopi;
+  int i = min(static_cast<int>(u), nb_cells_ - 1);
+  int j = min(static_cast<int>(v), nb_cells_ - 1);
+  int k = min(static_cast<int>(w), nb_theta_ - 1);
+  const float *values = values_.get();
+  if (parameters_.mode == HEURISTIC_SAMPLED_MINIMUM)
+    return values[index(i, j, k)];
+
+  // trilinear interpolation, periodic in theta
+  double fu = u - i, fv = v - j, fw = w - k;
+  int k1 = (k + 1) % nb_theta_;
+  double c00 = values[index(i, j, k)] * (1 - fu) + values[index(i + 1, j, k)] * fu;
+  double c10 = values[index(i, j + 1, k)] * (1 - fu) + values[index(i + 1, j + 1, k)] * fu;
+  double c01 = values[index(i, j, k1)] * (1 - fu) + values[index(i + 1, j, k1)] * fu;
+  double c11 = values[index(i, j + 1, k1)] * (1 - fu) + values[index(i + 1, j + 1, k1)] * fu;
+  double c0 = c00 * (1 - fv) + c10 * fv;
+  double c1 = c01 * (1 - fv) + c11 * fv;
+  return c0 * (1 - fw) + c1 * fw;
+}
+
+bool Heuristic_Table::contains(double dx, double dy) const
+{
+  return dx >= origin_ && dx <= -origin_ && dy >= origin_ && dy <= -origin_;
+}
+
+double Heuristic_Table::get_max_error() const
+{
+  return max_error_;
+}
+
+const Heuristic_Table::Parameters &Heuristic_Table::get_parameters() const
+{
+  return parameters_;
+}
+
+bool Heuristic_Table::save(const string &filename, const Description &description) const
+{
+  File_Header header;
+  memset(&header, 0, sizeof(header));
+  if (!values_ || description.state_space.size() >= sizeof(header.state_space))
+    return false;
+  memcpy(header.magic, file_magic, sizeof(file_magic));
+  header.version = file_version;
+  header.byte_order = file_byte_order;
+  description.state_space.copy(header.state_space, description.state_space.size());
+  header.kappa = description.kappa;
+  header.sigma = description.sigma;
+  header.start_kappa = start_.kappa;
+  header.start_d = start_.d;
+  header.goal_kappa = goal_.kappa;
+  header.goal_d = goal_.d;
+  header.extent = parameters_.extent;
+  header.resolution = parameters_.resolution;
+  header.nb_theta = parameters_.nb_theta;
+  header.mode = parameters_.mode;
+  header.nb_subsamples = parameters_.nb_subsamples;
+  header.nb_cells = nb_cells_;
+  header.nb_x = nb_x_;
+  header.nb_y = nb_y_;
+  header.nb_theta_values = nb_theta_;
+  header.origin = origin_;
+  header.max_error = max_error_;
+  header.nb_values = nb_values_;
+  header.checksum = checksum(header, values_.get());
+
+  // the file is written under a unique temporary name in the target directory and renamed, processes that load it
+  // concurrently either map the old or the new file, concurrent writers do not share the temporary file
+  vector<char> temporary(filename.begin(), filename.end());
+  const char suffix[] = ".XXXXXX";
+  temporary.insert(temporary.end(), suffix, suffix + sizeof(suffix));
+  int fd = mkstemp(temporary.data());
+  if (fd < 0)
+    return false;
+  bool written = fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) == 0 && write_all(fd, &header, sizeof(header)) &&
+                 write_all(fd, values_.get(), nb_values_ * sizeof(float));
+  if (close(fd) != 0 || !written || rename(temporary.data(), filename.c_str()) != 0)
+  {
+    unlink(temporary.data());
+    return false;
+  }
+  return true;
+}
+
+bool Heuristic_Table::load(const string &filename, const Description &description, bool verify_checksum)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat status;
+  if (fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(File_Header))
+  {
+    close(fd);
+    return false;
+  }
+  size_t size = status.st_size;
+  void *address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping remains valid after the file is closed
+  close(fd);
+  if (address == MAP_FAILED)
+    return false;
+  shared_ptr<const char> mapping(static_cast<const char *>(address),
+                                 [size](const char *data) { munmap(const_cast<char *>(data), size); });
+
+  const File_Header &header = *reinterpret_cast<const File_Header *>(mapping.get());
+  const float *values = reinterpret_cast<const float *>(mapping.get() + sizeof(File_Header));
+  if (memcmp(header.magic, file_magic, sizeof(file_magic)) != 0 || header.version != file_version ||
+      header.byte_order != file_byte_order)
+    return false;
+  if (header.nb_x <= 0 || header.nb_y <= 0 || header.nb_theta_values <= 0 || header.nb_cells <= 0 ||
+      header.nb_values != static_cast<uint64_t>(header.nb_x) * header.nb_y * header.nb_theta_values ||
+      size != sizeof(File_Header) + header.nb_values * sizeof(float))
+    return false;
+  if ((header.mode != HEURISTIC_INTERPOLATED && header.mode != HEURISTIC_SAMPLED_MINIMUM) ||
+      header.nb_x != header.nb_cells + (header.mode == HEURISTIC_INTERPOLATED) || header.nb_y != header.nb_x ||
+      header.nb_theta_values != header.nb_theta || header.nb_subsamples <= 0)
+    return false;
+  // the grid has to match the one that build derives from extent and resolution (a valid checksum does not protect
+  // against a file that was written with a corrupted header)
+  if (!(header.extent > 0.0) || !(header.resolution > 0.0) || !std::isfinite(header.extent) ||
+      !std::isfinite(header.resolution) || header.nb_cells != get_nb_cells(header.extent, header.resolution) ||
+      header.origin != -0.5 * header.nb_cells * header.resolution)
+    return false;
+  if (strncmp(header.state_space, description.state_space.c_str(), sizeof(header.state_space)) != 0 ||
+      header.kappa != description.kappa || header.sigma != description.sigma)
+    return false;
+  if (verify_checksum && header.checksum != checksum(header, values))
+    return false;
+
+  parameters_.extent = header.extent;
+  parameters_.resolution = header.resolution;
+  parameters_.nb_theta = header.nb_theta;
+  parameters_.mode = static_cast<Mode>(header.mode);
+  parameters_.nb_subsamples = header.nb_subsamples;
+  nb_cells_ = header.nb_cells;
+  nb_x_ = header.nb_x;
+  nb_y_ = header.nb_y;
+  nb_theta_ = header.nb_theta_values;
+  origin_ = header.origin;
+  max_error_ = header.max_error;
+  start_ = State();
+  start_.kappa = header.start_kappa;
+  start_.d = header.start_d;
+  goal_ = State();
+  goal_.kappa = header.goal_kappa;
+  goal_.d = header.goal_d;
+  nb_values_ = header.nb_values;
+  values_ = shared_ptr<const float>(mapping, values);
+  return true;
+}
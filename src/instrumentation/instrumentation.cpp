@@ -0,0 +1,165 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include <algorithm>
+#include <mutex>
+
+#include "steering_functions/instrumentation/instrumentation.hpp"
+
+namespace
+{
+const char *const state_space_names[nb_instrumented_state_spaces] = {
+  "CC_Dubins", "CC_Reeds_Shepp", "HC00_Reeds_Shepp", "HC0pm_Reeds_Shepp", "HCpm0_Reeds_Shepp", "HCpmpm_Reeds_Shepp",
+  "Reeds_Shepp"
+};
+
+// names of the families in the order of cc_dubins_family, hc_cc_rs_path_type and reeds_shepp_family
+const char *const cc_dubins_names[] = { "E", "S", "L", "R", "LSL", "LSR", "RSL", "RSR", "LRL", "RLR" };
+const char *const hc_cc_rs_names[] = { "EMPTY", "STRAIGHT", "T",     "TT",      "TcT",   "TcTcT",
+                                       "TcTT",  "TTcT",     "TST",   "TSTcT",   "TcTST", "TcTSTcT",
+                                       "TTcTT", "TcTTcT",   "TTT",   "TcST",    "TScT",  "TcScT" };
+const char *const reeds_shepp_names[] = { "CSC", "CCC", "CCCC", "CCSC", "CCSCC" };
+
+int nb_families(int state_space)
+{
+  if (state_space == INSTRUMENTED_CC_DUBINS)
+    return sizeof(cc_dubins_names) / sizeof(cc_dubins_names[0]);
+  if (state_space == INSTRUMENTED_REEDS_SHEPP)
+    return sizeof(reeds_shepp_names) / sizeof(reeds_shepp_names[0]);
+  return sizeof(hc_cc_rs_names) / sizeof(hc_cc_rs_names[0]);
+}
+
+const char *family_name(int state_space, int family)
+{
+  if (state_space == INSTRUMENTED_CC_DUBINS)
+    return cc_dubins_names[family];
+  if (state_space == INSTRUMENTED_REEDS_SHEPP)
+    return reeds_shepp_names[family];
+  return hc_cc_rs_names[family];
+}
+
+typedef Family_Statistics Statistics_Block[nb_instrumented_state_spaces][max_instrumented_families];
+
+void clear(Statistics_Block &block)
+{
+  for (int i = 0; i < nb_instrumented_state_spaces; i++)
+    for (int j = 0; j < max_instrumented_families; j++)
+      block[i][j] = { 0, 0, 0, 0.0 };
+}
+
+void accumulate(Statistics_Block &sum, const Statistics_Block &block)
+{
+  for (int i = 0; i < nb_instrumented_state_spaces; i++)
+    for (int j = 0; j < max_instrumented_families; j++)
+    {
+      sum[i][j].nb_evaluations += block[i][j].nb_evaluations;
+      sum[i][j].nb_hits += block[i][j].nb_hits;
+      sum[i][j].nb_wins += block[i][j].nb_wins;
+      sum[i][j].time += block[i][j].time;
+    }
+}
+
+/** \brief Statistics blocks of the running threads and the accumulated statistics of the finished threads */
+struct Statistics_Registry
+{
+  mutex registry_mutex;
+  vector<Statistics_Block *> blocks;
+  Statistics_Block finished;
+};
+
+Statistics_Registry &registry()
+{
+  // never destroyed, threads may finish after the static objects were destroyed
+  static Statistics_Registry *statistics_registry = new Statistics_Registry();
+  return *statistics_registry;
+}
+
+/** \brief Statistics of a thread, registered on the first use and accumulated when the thread finishes */
+struct Thread_Statistics
+{
+  Thread_Statistics()
+  {
+    clear(block);
+    lock_guard<mutex> lock(registry().registry_mutex);
+    registry().blocks.push_back(&block);
+  }
+
+  ~Thread_Statistics()
+  {
+    lock_guard<mutex> lock(registry().registry_mutex);
+    accumulate(registry().finished, block);
+    registry().blocks.erase(find(registry().blocks.begin(), registry().blocks.end(), &block));
+  }
+
+  Statistics_Block block;
+};
+
+thread_local Thread_Statistics thread_statistics;
+}
+
+bool Instrumentation::enabled()
+{
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+vector<Family_Record> Instrumentation::snapshot()
+{
+  vector<Family_Record> records;
+  if (!enabled())
+    return records;
+  Statistics_Block sum;
+  {
+    lock_guard<mutex> lock(registry().registry_mutex);
+    clear(sum);
+    accumulate(sum, registry().finished);
+    for (const auto block : registry().blocks)
+      accumulate(sum, *block);
+  }
+  for (int i = 0; i < nb_instrumented_state_spaces; i++)
+    for (int j = 0; j < nb_families(i); j++)
+      records.push_back({ state_space_names[i], family_name(i, j), sum[i][j] });
+  return records;
+}
+
+void Instrumentation::reset()
+{
+  lock_guard<mutex> lock(registry().registry_mutex);
+  clear(registry().finished);
+  for (auto block : registry().blocks)
+    clear(*block);
+}
+
+void Instrumentation::dump(ostream &out)
+{
+  out << "state_space,family,evaluations,hits,hit_rate,wins,time" << endl;
+  for (const auto &record : snapshot())
+  {
+    const Family_Statistics &statistics = record.statistics;
+    double hit_rate = statistics.nb_evaluations ? double(statistics.nb_hits) / statistics.nb_evaluations : 0.0;
+    out << record.state_space << "," << record.family << "," << statistics.nb_evaluations << "," << statistics.nb_hits
+        << "," << hit_rate << "," << statistics.nb_wins << "," << statistics.time << endl;
+  }
+}
+
+Family_Statistics &Instrumentation::statistics(Instrumented_State_Space state_space, int family)
+{
+  return thread_statistics.block[state_space][family];
+}
@@ -0,0 +1,453 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "steering_functions/hc_cc_state_space/utilities.hpp"
+#include "steering_functions/path_range/path_range.hpp"
+
+Path_Range::Path_Range(const State &start, const vector<Control> &controls, double discretization,
+                       const Convention &convention)
+  : start_(start), controls_(controls), discretization_(discretization), convention_(convention), size_(0)
+{
+  segments_.reserve(controls_.size());
+  State state_curr = first_state(start, controls_, convention_);
+  if (convention_.hc_cc)
+  {
+    start_ = state_curr;
+    size_ = 1;
+  }
+  double s_start = 0.0;
+  for (const auto &control : controls_)
+  {
+    Segment segment = make_segment(control, state_curr, s_start, size_, discretization_, convention_);
+    segments_.push_back(segment);
+    size_ += segment.nb_states;
+    // the last sample is the start of the next segment
+    state_curr = last_state(segment, control, discretization_, convention_);
+    s_start += segment.length;
+  }
+}
+
+State Path_Range::first_state(const State &start, const vector<Control> &controls, const Convention &convention)
+{
+  State state = start;
+  if (convention.hc_cc && !controls.empty())
+  {
+    state.kappa = controls.front().kappa;
+    state.d = sgn(controls.front().delta_s);
+  }
+  return state;
+}
+
+Path_Range::Segment Path_Range::make_segment(const Control &control, const State &state_prev, double s_start,
+                                             size_t first_index, double discretization, const Convention &convention)
+{
+  double abs_delta_s(fabs(control.delta_s));
+  double d(sgn(control.delta_s));
+  Segment segment;
+  segment.start = state_prev;
+  segment.repeated_start = false;
+  segment.degenerate = false;
+  int nb_samples = 0;
+  if (convention.hc_cc)
+  {
+    // repeated state if curvature discontinuity
+    if (fabs(control.kappa - state_prev.kappa) > get_epsilon())
+    {
+      segment.start.kappa = control.kappa;
+      segment.start.d = d;
+      segment.repeated_start = true;
+    }
+    // segments below the resolution of the arc length leave the state unchanged (degenerate clothoids of vanishing
+    // length have an unbounded sharpness)
+    if (abs_delta_s < numeric_limits<double>::epsilon() * discretization)
+    {
+      segment.degenerate = abs_delta_s > 0.0;
+      if (segment.degenerate)
+      {
+        segment.start.d = d;
+        nb_samples = 1;
+      }
+    }
+  }
+  else
+  {
+    segment.start.kappa = control.kappa;
+    segment.start.d = d;
+    segment.repeated_start = true;
+  }
+  if (abs_delta_s > 0.0 && !segment.degenerate)
+  {
+    // smallest number of samples n with n * discretization >= abs_delta_s
+    nb_samples = max(1, static_cast<int>(ceil(abs_delta_s / discretization)));
+    while (nb_samples > 1 && (nb_samples - 1) * discretization >= abs_delta_s)
+      nb_samples--;
+    while (nb_samples * discretization < abs_delta_s)
+      nb_samples++;
+  }
+  segment.s_start = s_start;
+  segment.length = abs_delta_s;
+  segment.nb_samples = nb_samples;
+  segment.first_index = first_index;
+  segment.nb_states = (segment.repeated_start ? 1 : 0) + nb_samples;
+  return segment;
+}
+
+State Path_Range::last_state(const Segment &segment, const Control &control, double discretization,
+                             const Convention &convention)
+{
+  if (segment.nb_samples == 0)
+    return segment.start;
+  return segment_state(segment, control, segment_arc_length(segment, segment.nb_states - 1, discretization),
+                       convention);
+}
+
+size_t Path_Range::sample(const State &start, const vector<Control> &controls, double discretization,
+                          const Convention &convention, double *x, double *y, double *theta, double *kappa, double *d,
+                          size_t capacity)
+{
+  size_t size = 0;
+  auto write = [&](const State &state) {
+    if (size < capacity)
+    {
+      if (x)
+        x[size] = state.x;
+      if (y)
+        y[size] = state.y;
+      if (theta)
+        theta[size] = state.theta;
+      if (kappa)
+        kappa[size] = state.kappa;
+      if (d)
+        d[size] = state.d;
+    }
+    size++;
+  };
+  State state_curr = first_state(start, controls, convention);
+  if (convention.hc_cc)
+    write(state_curr);
+  double s_start = 0.0;
+  for (const auto &control : controls)
+  {
+    Segment segment = make_segment(control, state_curr, s_start, size, discretization, convention);
+    // only the start of the next segment is evaluated once the buffers are full
+    if (size + segment.nb_states <= capacity)
+    {
+      for (int position = 0; position < segment.nb_states - 1; position++)
+        write(segment_state(segment, control, segment_arc_length(segment, position, discretization), convention));
+      state_curr = last_state(segment, control, discretization, convention);
+      if (segment.nb_states > 0)
+        write(state_curr);
+    }
+    else
+    {
+      for (int position = 0; position < segment.nb_states && size < capacity; position++)
+        write(segment_state(segment, control, segment_arc_length(segment, position, discretization), convention));
+      size = segment.first_index + segment.nb_states;
+      state_curr = last_state(segment, control, discretization, convention);
+    }
+    s_start += segment.length;
+  }
+  return size;
+}
+
+State Path_Range::append_segment(const Segment &segment, const Control &control, double discretization,
+                                 const Convention &convention, vector<State> *path)
+{
+  if (segment.nb_states == 0)
+    return segment.start;
+  size_t first_index = path->size();
+  path->resize(first_index + segment.nb_states);
+  // the arc lengths of the states are evaluated in blocks on the stack
+  const int block_size = 64;
+  double s[block_size];
+  for (int position = 0; position < segment.nb_states; position += block_size)
+  {
+    int m = min(block_size, segment.nb_states - position);
+    for (int j = 0; j < m; j++)
+      s[j] = segment_arc_length(segment, position + j, discretization);
+    segment_states(segment, control, s, m, convention, path->data() + first_index + position);
+  }
+  return path->back();
+}
+
+vector<State> Path_Range::sample(const State &start, const vector<Control> &controls, double discretization,
+                                 const Convention &convention)
+{
+  vector<State> path;
+  // reserve capacity of path
+  size_t n_states = 1;
+  for (const auto &control : controls)
+    n_states += ceil(fabs(control.delta_s) / discretization) + 1;
+  path.reserve(n_states);
+  State state_curr = first_state(start, controls, convention);
+  if (convention.hc_cc)
+    path.push_back(state_curr);
+  double s_start = 0.0;
+  for (const auto &control : controls)
+  {
+    Segment segment = make_segment(control, state_curr, s_start, path.size(), discretization, convention);
+    state_curr = append_segment(segment, control, discretization, convention, &path);
+    s_start += segment.length;
+  }
+  return path;
+}
+
+double Path_Range::adaptive_step(const Segment &segment, const Control &control, double tolerance)
+{
+  // upper bound of the curvature on the segment (linear in the arc length)
+  double kappa_max = fabs(segment.start.kappa) + fabs(control.sigma) * segment.length;
+  if (kappa_max < get_epsilon())
+    return segment.length;
+  // the deviation of a curve with curvature <= kappa_max from the chord of a step h is bounded by the sagitta
+  // (1 - cos(kappa_max * h / 2)) / kappa_max of the circular arc, steps are limited to half a circle
+  return 2 * acos(max(1 - tolerance * kappa_max, -1.0)) / kappa_max;
+}
+
+vector<State> Path_Range::sample_adaptive(const State &start, const vector<Control> &controls, double tolerance,
+                                          const Convention &convention)
+{
+  vector<State> path;
+  // a tolerance that is not positive and finite leads to steps of zero or an undefined length
+  if (!(tolerance > 0.0 && tolerance < numeric_limits<double>::infinity()))
+    return path;
+  State state_curr = first_state(start, controls, convention);
+  if (convention.hc_cc)
+    path.push_back(state_curr);
+  double s_start = 0.0;
+  for (const auto &control : controls)
+  {
+    // equal steps on the segment that do not exceed the adaptive step, segments below the resolution of the
+    // tolerance are degenerate
+    double length = fabs(control.delta_s);
+    Segment segment = make_segment(control, state_curr, s_start, path.size(), tolerance, convention);
+    double discretization = tolerance;
+    if (length > 0.0 && !segment.degenerate)
+    {
+      discretization = length / ceil(length / adaptive_step(segment, control, tolerance));
+      segment = make_segment(control, state_curr, s_start, path.size(), discretization, convention);
+    }
+    state_curr = append_segment(segment, control, discretization, convention, &path);
+    s_start += segment.length;
+  }
+  return path;
+}
+
+Path_Range::Iterator Path_Range::begin() const
+{
+  if (size_ == 0)
+    return end();
+  if (convention_.hc_cc)
+    return Iterator(this, 0, -1, 0);
+  int segment = 0;
+  while (segments_[segment].nb_states == 0)
+    segment++;
+  return Iterator(this, 0, segment, 0);
+}
+
+Path_Range::Iterator Path_Range::end() const
+{
+  return Iterator(this, size_, segments_.size(), 0);
+}
+
+double Path_Range::length() const
+{
+  if (segments_.empty())
+    return 0.0;
+  return segments_.back().s_start + segments_.back().length;
+}
+
+Path_Range::Iterator Path_Range::seek(double s) const
+{
+  if (s <= 0.0)
+    return begin();
+  // first segment with samples that reaches s
+  auto it = lower_bound(segments_.begin(), segments_.end(), s,
+                        [](const Segment &segment, double s) { return segment.s_start + segment.length < s; });
+  while (it != segments_.end() && (it->degenerate || it->nb_samples == 0))
+    ++it;
+  if (it == segments_.end())
+    return end();
+  int segment = it - segments_.begin();
+  // first sample of the segment with an arc length of at least s
+  const Segment &seg = segments_[segment];
+  int offset = seg.repeated_start ? 1 : 0;
+  int sample = min(max(static_cast<int>(ceil((s - seg.s_start) / discretization_)), 1), seg.nb_samples);
+  int position = sample - 1 + offset;
+  while (position > offset && seg.s_start + segment_arc_length(seg, position - 1, discretization_) >= s)
+    position--;
+  while (position + 1 < seg.nb_states && seg.s_start + segment_arc_length(seg, position, discretization_) < s)
+    position++;
+  return Iterator(this, seg.first_index + position, segment, position);
+}
+
+int Path_Range::find_segment(double s) const
+{
+  auto it = lower_bound(segments_.begin(), segments_.end(), s,
+                        [](const Segment &segment, double s) { return segment.s_start + segment.length < s; });
+  if (it == segments_.end())
+    return segments_.size() - 1;
+  return it - segments_.begin();
+}
+
+State Path_Range::state_at(double s) const
+{
+  if (segments_.empty() || s <= 0.0)
+    return convention_.hc_cc || segments_.empty() ? start_ : segments_.front().start;
+  int segment = find_segment(s);
+  const Segment &seg = segments_[segment];
+  return segment_state(seg, controls_[segment], min(s - seg.s_start, seg.length), convention_);
+}
+
+void Path_Range::states_at(const double *s, size_t n, State *states) const
+{
+  size_t i = 0;
+  for (; i < n && (segments_.empty() || s[i] <= 0.0); i++)
+    states[i] = state_at(s[i]);
+  if (i == n)
+    return;
+  // the segment of the previous query is the lower bound for the next one
+  int segment = find_segment(s[i]);
+  int last = segments_.size() - 1;
+  for (; i < n; i++)
+  {
+    while (segment < last && segments_[segment].s_start + segments_[segment].length < s[i])
+      segment++;
+    const Segment &seg = segments_[segment];
+    states[i] = segment_state(seg, controls_[segment], min(s[i] - seg.s_start, seg.length), convention_);
+  }
+}
+
+double Path_Range::segment_arc_length(const Segment &segment, int position, double discretization)
+{
+  if (segment.degenerate || (segment.repeated_start && position == 0))
+    return 0.0;
+  int sample = position - (segment.repeated_start ? 1 : 0) + 1;
+  if (sample < segment.nb_samples)
+    return sample * discretization;
+  return segment.length;
+}
+
+State Path_Range::state(int segment, int position) const
+{
+  const Segment &seg = segments_[segment];
+  if (seg.degenerate || (seg.repeated_start && position == 0))
+    return seg.start;
+  return segment_state(seg, controls_[segment], segment_arc_length(seg, position, discretization_), convention_);
+}
+
+State Path_Range::segment_state(const Segment &segment, const Control &control, double s,
+                                const Convention &convention)
+{
+  State state;
+  segment_states(segment, control, &s, 1, convention, &state);
+  return state;
+}
+
+void Path_Range::segment_states(const Segment &segment, const Control &control, const double *s, size_t n,
+                                const Convention &convention, State *states)
+{
+  const State &start = segment.start;
+  double kappa(control.kappa);
+  double d(sgn(control.delta_s));
+  // closed form from the start of the segment
+  if (segment.degenerate)
+    fill(states, states + n, start);
+  else if (convention.hc_cc && control.sigma != 0.0)
+  {
+    // the clothoid is evaluated in blocks on the stack
+    const size_t block_size = 64;
+    double x[block_size], y[block_size], theta[block_size], kappa_f[block_size];
+    for (size_t i = 0; i < n; i += block_size)
+    {
+      size_t m = min(block_size, n - i);
+      end_of_clothoid(start.x, start.y, start.theta, start.kappa, control.sigma, d > 0, s + i, m, x, y, theta,
+                      kappa_f);
+      for (size_t j = 0; j < m; j++)
+      {
+        states[i + j].x = x[j];
+        states[i + j].y = y[j];
+        states[i + j].theta = theta[j];
+        states[i + j].kappa = kappa_f[j];
+        states[i + j].d = d;
+      }
+    }
+  }
+  else
+  {
+    double sin_th = sin(start.theta);
+    double cos_th = cos(start.theta);
+    for (size_t i = 0; i < n; i++)
+    {
+      State &state = states[i];
+      if (kappa != 0.0)
+      {
+        state.x = start.x + (1 / kappa) * (-sin_th + sin(start.theta + d * s[i] * kappa));
+        state.y = start.y + (1 / kappa) * (cos_th - cos(start.theta + d * s[i] * kappa));
+        state.theta = convention.normalize_theta(start.theta + d * s[i] * kappa);
+      }
+      else
+      {
+        state.x = start.x + d * s[i] * cos_th;
+        state.y = start.y + d * s[i] * sin_th;
+        state.theta = start.theta;
+      }
+      state.kappa = kappa;
+      state.d = d;
+    }
+  }
+  // the repeated start state
+  if (segment.repeated_start)
+    for (size_t i = 0; i < n; i++)
+      if (s[i] == 0.0)
+        states[i] = start;
+}
+
+Path_Range::Iterator::Iterator(const Path_Range *range, size_t index, int segment, int position)
+  : range_(range), index_(index), segment_(segment), position_(position)
+{
+  if (index_ < range_->size_)
+    state_ = (segment_ < 0) ? range_->start_ : range_->state(segment_, position_);
+}
+
+Path_Range::Iterator &Path_Range::Iterator::operator++()
+{
+  index_++;
+  if (index_ >= range_->size_)
+    return *this;
+  if (segment_ < 0 || ++position_ >= range_->segments_[segment_].nb_states)
+  {
+    // next segment with states
+    position_ = 0;
+    do
+      segment_++;
+    while (range_->segments_[segment_].nb_states == 0);
+  }
+  state_ = range_->state(segment_, position_);
+  return *this;
+}
+
+double Path_Range::Iterator::arc_length() const
+{
+  if (segment_ < 0)
+    return 0.0;
+  return range_->segments_[segment_].s_start +
+         segment_arc_length(range_->segments_[segment_], position_, range_->discretization_);
+}
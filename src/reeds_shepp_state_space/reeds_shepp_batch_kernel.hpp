@@ -0,0 +1,255 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef REEDS_SHEPP_BATCH_KERNEL_HPP
+#define REEDS_SHEPP_BATCH_KERNEL_HPP
+
+#include <cstddef>
+#include <limits>
+
+#include "simd/simd.hpp"
+
+namespace
+{
+/** \brief
+    SIMD version of the Reeds-Shepp formulas in reeds_shepp_state_space.cpp. Each formula is evaluated on all lanes
+    and the results are masked by the conditions of the scalar implementation. The basic arithmetic is carried out in
+    the same order as in the scalar code (the translation units are compiled with -ffp-contract=off), only sin, cos and
+    atan2 are replaced by polynomial approximations (Cephes) that differ from the C library by a few ulp.
+    */
+template <typename Isa>
+class Reeds_Shepp_Kernel
+{
+public:
+  typedef Vec<Isa> V;
+  typedef Mask<Isa> M;
+
+  /** \brief Stores the lengths of the shortest paths from the origin to (x[i], y[i], phi[i]) in lengths[i] */
+  static void lengths(const double *x, const double *y, const double *phi, size_t n, double *lengths)
+  {
+    const size_t width = Isa::WIDTH;
+    size_t i = 0;
+    for (; i + width <= n; i += width)
+    {
+      V length = reeds_shepp(Isa::load(x + i), Isa::load(y + i), Isa::load(phi + i));
+      Isa::store(lengths + i, length.v);
+    }
+    if (i < n)
+    {
+      // the remaining queries are padded with the origin
+      double x_rem[Isa::WIDTH] = { 0 }, y_rem[Isa::WIDTH] = { 0 }, phi_rem[Isa::WIDTH] = { 0 };
+      double lengths_rem[Isa::WIDTH];
+      for (size_t j = i; j < n; j++)
+      {
+        x_rem[j - i] = x[j];
+        y_rem[j - i] = y[j];
+        phi_rem[j - i] = phi[j];
+      }
+      V length = reeds_shepp(Isa::load(x_rem), Isa::load(y_rem), Isa::load(phi_rem));
+      Isa::store(lengths_rem, length.v);
+      for (size_t j = i; j < n; j++)
+        lengths[j] = lengths_rem[j - i];
+    }
+  }
+
+private:
+  static V mod2pi(const V &x)
+  {
+    V v = fnmadd(trunc(x / V(twopi())), V(twopi()), x);
+    return select(v < V(-M_PI), v + V(twopi()), select(v > V(M_PI), v - V(twopi()), v));
+  }
+  static void polar(const V &x, const V &y, V &r, V &theta)
+  {
+    r = sqrt(x * x + y * y);
+    theta = atan2(y, x);
+  }
+  static void tauOmega(const V &u, const V &v, const V &xi, const V &eta, const V &phi, V &tau, V &omega)
+  {
+    V sin_u, cos_u, sin_v, cos_v, sin_delta, cos_delta;
+    V delta = mod2pi(u - v);
+    sincos(u, sin_u, cos_u);
+    sincos(v, sin_v, cos_v);
+    sincos(delta, sin_delta, cos_delta);
+    V A = sin_u - sin_delta, B = cos_u - cos_delta - V(1.);
+    V t1 = atan2(eta * A - xi * B, xi * A + eta * B), t2 = V(2.) * (cos_delta - cos_v - cos_u) + V(3.);
+    tau = select(t2 < V(0.), mod2pi(t1 + V(M_PI)), mod2pi(t1));
+    omega = mod2pi(tau - u + v - phi);
+  }
+
+  // formula 8.1
+  static M LpSpLp(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    polar(x - sin_phi, y - V(1.) + cos_phi, u, t);
+    v = mod2pi(phi - t);
+    return (t >= V(-zero())) & (v >= V(-zero()));
+  }
+  // formula 8.2
+  static M LpSpRp(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V t1, u1;
+    polar(x + sin_phi, y - V(1.) - cos_phi, u1, t1);
+    u1 = u1 * u1;
+    u = sqrt(u1 - V(4.));
+    t = mod2pi(t1 + atan2(V(2.), u));
+    v = mod2pi(t - phi);
+    return (u1 >= V(4.)) & (t >= V(-zero())) & (v >= V(-zero()));
+  }
+  // formula 8.3 / 8.4
+  static M LpRmL(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x - sin_phi, eta = y - V(1.) + cos_phi, u1, theta;
+    polar(xi, eta, u1, theta);
+    u = V(-2.) * asin(V(.25) * u1);
+    t = mod2pi(theta + V(.5) * u + V(M_PI));
+    v = mod2pi(phi - t + u);
+    return (u1 <= V(4.)) & (t >= V(-zero())) & (u <= V(zero()));
+  }
+  // formula 8.7
+  static M LpRupLumRm(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x + sin_phi, eta = y - V(1.) - cos_phi, rho = V(.25) * (V(2.) + sqrt(xi * xi + eta * eta));
+    u = acos(rho);
+    tauOmega(u, -u, xi, eta, phi, t, v);
+    return (rho <= V(1.)) & (t >= V(-zero())) & (v <= V(zero()));
+  }
+  // formula 8.8
+  static M LpRumLumRp(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x + sin_phi, eta = y - V(1.) - cos_phi, rho = (V(20.) - xi * xi - eta * eta) / V(16.);
+    u = -acos(rho);
+    tauOmega(u, u, xi, eta, phi, t, v);
+    return (rho >= V(0.)) & (rho <= V(1.)) & (u >= V(-.5 * M_PI)) & (t >= V(-zero())) & (v >= V(-zero()));
+  }
+  // formula 8.9
+  static M LpRmSmLm(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x - sin_phi, eta = y - V(1.) + cos_phi, rho, theta;
+    polar(xi, eta, rho, theta);
+    V r = sqrt(rho * rho - V(4.));
+    u = V(2.) - r;
+    t = mod2pi(theta + atan2(r, V(-2.)));
+    v = mod2pi(phi - V(.5 * M_PI) - t);
+    return (rho >= V(2.)) & (t >= V(-zero())) & (u <= V(zero())) & (v <= V(zero()));
+  }
+  // formula 8.10
+  static M LpRmSmRm(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x + sin_phi, eta = y - V(1.) - cos_phi, rho, theta;
+    polar(-eta, xi, rho, theta);
+    t = theta;
+    u = V(2.) - rho;
+    v = mod2pi(t + V(.5 * M_PI) - phi);
+    return (rho >= V(2.)) & (t >= V(-zero())) & (u <= V(zero())) & (v <= V(zero()));
+  }
+  // formula 8.11
+  static M LpRmSLmRp(const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi, V &t, V &u, V &v)
+  {
+    V xi = x + sin_phi, eta = y - V(1.) - cos_phi, rho, theta;
+    polar(xi, eta, rho, theta);
+    u = V(4.) - sqrt(rho * rho - V(4.));
+    t = mod2pi(atan2((V(4.) - u) * xi - V(2.) * eta, V(-2.) * xi + (u - V(4.)) * eta));
+    v = mod2pi(t - phi);
+    return (rho >= V(2.)) & (u <= V(zero())) & (t >= V(-zero())) & (v >= V(-zero()));
+  }
+
+  /** \brief Keeps the candidate with length L and total length total if it is valid and shorter than Lmin */
+  static void update(const M &valid, const V &L, const V &total, V &Lmin, V &length)
+  {
+    M shorter = valid & (Lmin > L);
+    Lmin = select(shorter, L, Lmin);
+    length = select(shorter, total, length);
+  }
+
+  /** \brief Total length of the path with the given segment lengths (as computed by Reeds_Shepp_Path) */
+  static V total(const V &a, const V &b, const V &c, const V &d = V(0.), const V &e = V(0.))
+  {
+    return fabs(a) + fabs(b) + fabs(c) + fabs(d) + fabs(e);
+  }
+
+  typedef M (*Formula)(const V &, const V &, const V &, const V &, const V &, V &, V &, V &);
+
+  /** \brief Evaluates formula for the four symmetric variants (original, timeflip, reflect, timeflip + reflect) */
+  static void evaluate(Formula formula, const V &x, const V &y, const V &phi, const V &sin_phi, const V &cos_phi,
+                       bool backwards, double weight_u, double offset, int nb_offsets, V &Lmin, V &length)
+  {
+    const V xs[] = { x, -x, x, -x }, ys[] = { y, y, -y, -y }, phis[] = { phi, -phi, -phi, phi },
+            sin_phis[] = { sin_phi, -sin_phi, -sin_phi, sin_phi };
+    for (int i = 0; i < 4; i++)
+    {
+      V t, u, v;
+      M valid = formula(xs[i], ys[i], phis[i], sin_phis[i], cos_phi, t, u, v);
+      V L = fabs(t) + V(weight_u) * fabs(u) + fabs(v);
+      V path_length;
+      if (weight_u == 2.)
+        path_length = total(t, u, u, v);
+      else if (nb_offsets == 2)
+        path_length = total(t, V(offset), u, V(offset), v);
+      else if (nb_offsets == 1 && backwards)
+        path_length = total(v, u, V(offset), t);
+      else if (nb_offsets == 1)
+        path_length = total(t, V(offset), u, v);
+      else if (backwards)
+        path_length = total(v, u, t);
+      else
+        path_length = total(t, u, v);
+      update(valid, L, path_length, Lmin, length);
+    }
+  }
+
+  static V reeds_shepp(const V &x, const V &y, const V &phi)
+  {
+    V length = V(std::numeric_limits<double>::max());
+    V sin_phi, cos_phi;
+    sincos(phi, sin_phi, cos_phi);
+    V xb = x * cos_phi + y * sin_phi, yb = x * sin_phi - y * cos_phi;
+    V Lmin;
+    // CSC
+    Lmin = length;
+    evaluate(LpSpLp, x, y, phi, sin_phi, cos_phi, false, 1., 0., 0, Lmin, length);
+    evaluate(LpSpRp, x, y, phi, sin_phi, cos_phi, false, 1., 0., 0, Lmin, length);
+    // CCC
+    Lmin = length;
+    evaluate(LpRmL, x, y, phi, sin_phi, cos_phi, false, 1., 0., 0, Lmin, length);
+    evaluate(LpRmL, xb, yb, phi, sin_phi, cos_phi, true, 1., 0., 0, Lmin, length);
+    // CCCC
+    Lmin = length;
+    evaluate(LpRupLumRm, x, y, phi, sin_phi, cos_phi, false, 2., 0., 0, Lmin, length);
+    evaluate(LpRumLumRp, x, y, phi, sin_phi, cos_phi, false, 2., 0., 0, Lmin, length);
+    // CCSC
+    Lmin = length - V(.5 * M_PI);
+    evaluate(LpRmSmLm, x, y, phi, sin_phi, cos_phi, false, 1., .5 * M_PI, 1, Lmin, length);
+    evaluate(LpRmSmRm, x, y, phi, sin_phi, cos_phi, false, 1., .5 * M_PI, 1, Lmin, length);
+    evaluate(LpRmSmLm, xb, yb, phi, sin_phi, cos_phi, true, 1., .5 * M_PI, 1, Lmin, length);
+    evaluate(LpRmSmRm, xb, yb, phi, sin_phi, cos_phi, true, 1., .5 * M_PI, 1, Lmin, length);
+    // CCSCC
+    Lmin = length - V(M_PI);
+    evaluate(LpRmSLmRp, x, y, phi, sin_phi, cos_phi, false, 1., .5 * M_PI, 2, Lmin, length);
+    return length;
+  }
+
+  static double twopi()
+  {
+    return 2. * M_PI;
+  }
+  static double zero()
+  {
+    return 10 * std::numeric_limits<double>::epsilon();
+  }
+};
+}
+
+#endif
@@ -57,6 +57,11 @@
 *  POSSIBILITY OF SUCH DAMAGE.
 *********************************************************************/
 
+#include <algorithm>
+#include <cstdint>
+
+#include "steering_functions/instrumentation/instrumentation.hpp"
+#include "steering_functions/reeds_shepp_state_space/reeds_shepp_batch.hpp"
 #include "steering_functions/reeds_shepp_state_space/reeds_shepp_state_space.hpp"
 
 namespace
@@ -131,45 +136,47 @@ inline bool LpSpRp(double x, double y, double phi, double &t, double &u, double
   }
   return false;
 }
-void CSC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
+void CSC(double x, double y, double phi, unsigned candidates, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
 {
   double t, u, v, Lmin = path.length(), L;
-  if (LpSpLp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 0)) && LpSpLp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[14], t, u, v);
     Lmin = L;
   }
-  if (LpSpLp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 1)) && LpSpLp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[14], -t, -u, -v);
     Lmin = L;
   }
-  if (LpSpLp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 2)) && LpSpLp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[15], t, u, v);
     Lmin = L;
   }
-  if (LpSpLp(-x, -y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 3)) && LpSpLp(-x, -y, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[15], -t, -u, -v);
     Lmin = L;
   }
-  if (LpSpRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 4)) && LpSpRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[12], t, u, v);
     Lmin = L;
   }
-  if (LpSpRp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 5)) && LpSpRp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[12], -t, -u, -v);
     Lmin = L;
   }
-  if (LpSpRp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 6)) && LpSpRp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[13], t, u, v);
     Lmin = L;
   }
-  if (LpSpRp(-x, -y, phi, t, u, v) && Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 7)) && LpSpRp(-x, -y, phi, t, u, v) &&
+      Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[13], -t, -u, -v);
 }
 // formula 8.3 / 8.4  *** TYPO IN PAPER ***
@@ -189,25 +196,26 @@ inline bool LpRmL(double x, double y, double phi, double &t, double &u, double &
   }
   return false;
 }
-void CCC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
+void CCC(double x, double y, double phi, unsigned candidates, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
 {
   double t, u, v, Lmin = path.length(), L;
-  if (LpRmL(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 0)) && LpRmL(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[0], t, u, v);
     Lmin = L;
   }
-  if (LpRmL(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 1)) && LpRmL(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[0], -t, -u, -v);
     Lmin = L;
   }
-  if (LpRmL(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 2)) && LpRmL(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[1], t, u, v);
     Lmin = L;
   }
-  if (LpRmL(-x, -y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 3)) && LpRmL(-x, -y, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[1], -t, -u, -v);
     Lmin = L;
@@ -215,22 +223,24 @@ void CCC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Pa
 
   // backwards
   double xb = x * cos(phi) + y * sin(phi), yb = x * sin(phi) - y * cos(phi);
-  if (LpRmL(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 4)) && LpRmL(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[0], v, u, t);
     Lmin = L;
   }
-  if (LpRmL(-xb, yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 5)) && LpRmL(-xb, yb, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[0], -v, -u, -t);
     Lmin = L;
   }
-  if (LpRmL(xb, -yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 6)) && LpRmL(xb, -yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[1], v, u, t);
     Lmin = L;
   }
-  if (LpRmL(-xb, -yb, phi, t, u, v) && Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 7)) && LpRmL(-xb, -yb, phi, t, u, v) &&
+      Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[1], -v, -u, -t);
 }
 // formula 8.7
@@ -266,46 +276,52 @@ inline bool LpRumLumRp(double x, double y, double phi, double &t, double &u, dou
   }
   return false;
 }
-void CCCC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
+void CCCC(double x, double y, double phi, unsigned candidates, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
 {
   double t, u, v, Lmin = path.length(), L;
-  if (LpRupLumRm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))
+  if ((candidates & (1u << 0)) && LpRupLumRm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[2], t, u, -u, v);
     Lmin = L;
   }
-  if (LpRupLumRm(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 1)) && LpRupLumRm(-x, y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[2], -t, -u, u, -v);
     Lmin = L;
   }
-  if (LpRupLumRm(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 2)) && LpRupLumRm(x, -y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[3], t, u, -u, v);
     Lmin = L;
   }
-  if (LpRupLumRm(-x, -y, phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 3)) && LpRupLumRm(-x, -y, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[3], -t, -u, u, -v);
     Lmin = L;
   }
 
-  if (LpRumLumRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))
+  if ((candidates & (1u << 4)) && LpRumLumRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[2], t, u, u, v);
     Lmin = L;
   }
-  if (LpRumLumRp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 5)) && LpRumLumRp(-x, y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[2], -t, -u, -u, -v);
     Lmin = L;
   }
-  if (LpRumLumRp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 6)) && LpRumLumRp(x, -y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[3], t, u, u, v);
     Lmin = L;
   }
-  if (LpRumLumRp(-x, -y, phi, t, u, v) && Lmin > (fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 7)) && LpRumLumRp(-x, -y, phi, t, u, v) &&
+      Lmin > (fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[3], -t, -u, -u, -v);
 }
 // formula 8.9
@@ -343,53 +359,59 @@ inline bool LpRmSmRm(double x, double y, double phi, double &t, double &u, doubl
   }
   return false;
 }
-void CCSC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
+void CCSC(double x, double y, double phi, unsigned candidates, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
 {
   double t, u, v, Lmin = path.length() - .5 * pi, L;
-  if (LpRmSmLm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 0)) && LpRmSmLm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[4], t, -.5 * pi, u, v);
     Lmin = L;
   }
-  if (LpRmSmLm(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 1)) && LpRmSmLm(-x, y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[4], -t, .5 * pi, -u,
                                                      -v);
     Lmin = L;
   }
-  if (LpRmSmLm(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 2)) && LpRmSmLm(x, -y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[5], t, -.5 * pi, u, v);
     Lmin = L;
   }
-  if (LpRmSmLm(-x, -y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 3)) && LpRmSmLm(-x, -y, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[5], -t, .5 * pi, -u,
                                                      -v);
     Lmin = L;
   }
 
-  if (LpRmSmRm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 4)) && LpRmSmRm(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[8], t, -.5 * pi, u, v);
     Lmin = L;
   }
-  if (LpRmSmRm(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 5)) && LpRmSmRm(-x, y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[8], -t, .5 * pi, -u,
                                                      -v);
     Lmin = L;
   }
-  if (LpRmSmRm(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 6)) && LpRmSmRm(x, -y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[9], t, -.5 * pi, u, v);
     Lmin = L;
   }
-  if (LpRmSmRm(-x, -y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 7)) && LpRmSmRm(-x, -y, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[9], -t, .5 * pi, -u,
                                                      -v);
@@ -398,50 +420,56 @@ void CCSC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_P
 
   // backwards
   double xb = x * cos(phi) + y * sin(phi), yb = x * sin(phi) - y * cos(phi);
-  if (LpRmSmLm(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 8)) && LpRmSmLm(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[6], v, u, -.5 * pi, t);
     Lmin = L;
   }
-  if (LpRmSmLm(-xb, yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 9)) && LpRmSmLm(-xb, yb, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[6], -v, -u, .5 * pi,
                                                      -t);
     Lmin = L;
   }
-  if (LpRmSmLm(xb, -yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 10)) && LpRmSmLm(xb, -yb, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path =
         Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[7], v, u, -.5 * pi, t);
     Lmin = L;
   }
-  if (LpRmSmLm(-xb, -yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 11)) && LpRmSmLm(-xb, -yb, phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[7], -v, -u, .5 * pi,
                                                      -t);
     Lmin = L;
   }
 
-  if (LpRmSmRm(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 12)) && LpRmSmRm(xb, yb, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[10], v, u, -.5 * pi,
                                                      t);
     Lmin = L;
   }
-  if (LpRmSmRm(-xb, yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 13)) && LpRmSmRm(-xb, yb, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[10], -v, -u,
                                                      .5 * pi, -t);
     Lmin = L;
   }
-  if (LpRmSmRm(xb, -yb, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 14)) && LpRmSmRm(xb, -yb, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[11], v, u, -.5 * pi,
                                                      t);
     Lmin = L;
   }
-  if (LpRmSmRm(-xb, -yb, phi, t, u, v) && Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 15)) && LpRmSmRm(-xb, -yb, phi, t, u, v) &&
+      Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[11], -v, -u,
                                                      .5 * pi, -t);
 }
@@ -465,40 +493,331 @@ inline bool LpRmSLmRp(double x, double y, double phi, double &t, double &u, doub
   }
   return false;
 }
-void CCSCC(double x, double y, double phi, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
+void CCSCC(double x, double y, double phi, unsigned candidates, Reeds_Shepp_State_Space::Reeds_Shepp_Path &path)
 {
   double t, u, v, Lmin = path.length() - pi, L;
-  if (LpRmSLmRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
+  if ((candidates & (1u << 0)) && LpRmSLmRp(x, y, phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[16], t, -.5 * pi, u,
                                                      -.5 * pi, v);
     Lmin = L;
   }
-  if (LpRmSLmRp(-x, y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+  if ((candidates & (1u << 1)) && LpRmSLmRp(-x, y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[16], -t, .5 * pi,
                                                      -u, .5 * pi, -v);
     Lmin = L;
   }
-  if (LpRmSLmRp(x, -y, -phi, t, u, v) && Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+  if ((candidates & (1u << 2)) && LpRmSLmRp(x, -y, -phi, t, u, v) &&
+      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[17], t, -.5 * pi, u,
                                                      -.5 * pi, v);
     Lmin = L;
   }
-  if (LpRmSLmRp(-x, -y, phi, t, u, v) && Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+  if ((candidates & (1u << 3)) && LpRmSLmRp(-x, -y, phi, t, u, v) &&
+      Lmin > (fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     path = Reeds_Shepp_State_Space::Reeds_Shepp_Path(Reeds_Shepp_State_Space::reeds_shepp_path_type[17], -t, .5 * pi,
                                                      -u, .5 * pi, -v);
 }
 
-Reeds_Shepp_State_Space::Reeds_Shepp_Path reeds_shepp(double x, double y, double phi)
+// the 44 candidates are numbered in the order of evaluation: CSC 0-7, CCC 8-15, CCCC 16-23, CCSC 24-39, CCSCC 40-43
+const int nb_candidates = 44;
+const uint64_t all_candidates = (uint64_t(1) << nb_candidates) - 1;
+
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+/** \brief Returns whether the family improved the shortest path, the last improvement wins the query */
+bool improved(const Reeds_Shepp_State_Space::Reeds_Shepp_Path &path, double &length, int &winner,
+              reeds_shepp_family family)
+{
+  if (path.length() >= length)
+    return false;
+  length = path.length();
+  winner = family;
+  return true;
+}
+#endif
+
+Reeds_Shepp_State_Space::Reeds_Shepp_Path reeds_shepp(double x, double y, double phi,
+                                                      uint64_t candidates = all_candidates)
+{
+  Reeds_Shepp_State_Space::Reeds_Shepp_Path path;
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  double length = path.length();
+  int winner = -1;
+#endif
+  if (candidates & 0xff)
+  {
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_REEDS_SHEPP, RS_CSC);
+    CSC(x, y, phi, candidates & 0xff, path);
+    INSTRUMENTATION_FAMILY_HIT_IF(RS_CSC, improved(path, length, winner, RS_CSC));
+    INSTRUMENTATION_FAMILY_END(RS_CSC);
+  }
+  if ((candidates >> 8) & 0xff)
+  {
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_REEDS_SHEPP, RS_CCC);
+    CCC(x, y, phi, (candidates >> 8) & 0xff, path);
+    INSTRUMENTATION_FAMILY_HIT_IF(RS_CCC, improved(path, length, winner, RS_CCC));
+    INSTRUMENTATION_FAMILY_END(RS_CCC);
+  }
+  if ((candidates >> 16) & 0xff)
+  {
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_REEDS_SHEPP, RS_CCCC);
+    CCCC(x, y, phi, (candidates >> 16) & 0xff, path);
+    INSTRUMENTATION_FAMILY_HIT_IF(RS_CCCC, improved(path, length, winner, RS_CCCC));
+    INSTRUMENTATION_FAMILY_END(RS_CCCC);
+  }
+  if ((candidates >> 24) & 0xffff)
+  {
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_REEDS_SHEPP, RS_CCSC);
+    CCSC(x, y, phi, (candidates >> 24) & 0xffff, path);
+    INSTRUMENTATION_FAMILY_HIT_IF(RS_CCSC, improved(path, length, winner, RS_CCSC));
+    INSTRUMENTATION_FAMILY_END(RS_CCSC);
+  }
+  if ((candidates >> 40) & 0xf)
+  {
+    INSTRUMENTATION_FAMILY_BEGIN(INSTRUMENTED_REEDS_SHEPP, RS_CCSCC);
+    CCSCC(x, y, phi, (candidates >> 40) & 0xf, path);
+    INSTRUMENTATION_FAMILY_HIT_IF(RS_CCSCC, improved(path, length, winner, RS_CCSCC));
+    INSTRUMENTATION_FAMILY_END(RS_CCSCC);
+  }
+#ifdef STEERING_FUNCTIONS_INSTRUMENTATION
+  // a query without any path (only the partition's subsets of candidates) is not counted
+  if (winner >= 0)
+    INSTRUMENTATION_FAMILY_WIN(INSTRUMENTED_REEDS_SHEPP, winner);
+#endif
+  return path;
+}
+
+/** \brief Maps the configuration to x >= 0, y >= 0 by the timeflip (x < 0) and reflect (y < 0) symmetries, returns
+    the applied symmetries (bit 0: timeflip, bit 1: reflect) */
+int canonicalize(double &x, double &y, double &phi)
+{
+  int flip = 0;
+  if (x < 0)
+  {
+    x = -x;
+    phi = -phi;
+    flip |= 1;
+  }
+  if (y < 0)
+  {
+    y = -y;
+    phi = -phi;
+    flip |= 2;
+  }
+  return flip;
+}
+
+/** \brief Maps candidates of the canonical configuration back to the original configuration: the symmetries permute
+    the candidates within each group of four (base, timeflip, reflect, timeflip + reflect) */
+uint64_t uncanonicalize(uint64_t candidates, int flip)
+{
+  const uint64_t timeflip_mask = 0x55555555555, reflect_mask = 0x33333333333;
+  if (flip & 1)
+    candidates = ((candidates & timeflip_mask) << 1) | ((candidates >> 1) & timeflip_mask);
+  if (flip & 2)
+    candidates = ((candidates & reflect_mask) << 2) | ((candidates >> 2) & reflect_mask);
+  return candidates;
+}
+
+// formulas in the order of evaluation, each formula is a group of four candidates
+enum reeds_shepp_formula
+{
+  LpSpLp_FORMULA,
+  LpSpRp_FORMULA,
+  LpRmL_FORMULA,
+  LpRmL_BACKWARDS_FORMULA,
+  LpRupLumRm_FORMULA,
+  LpRumLumRp_FORMULA,
+  LpRmSmLm_FORMULA,
+  LpRmSmRm_FORMULA,
+  LpRmSmLm_BACKWARDS_FORMULA,
+  LpRmSmRm_BACKWARDS_FORMULA,
+  LpRmSLmRp_FORMULA
+};
+
+// symmetries in the order of evaluation within a group of four candidates
+enum reeds_shepp_symmetry
+{
+  BASE,
+  TIMEFLIP,
+  REFLECT,
+  TIMEFLIP_REFLECT
+};
+
+constexpr uint64_t candidate_bit(reeds_shepp_formula formula, reeds_shepp_symmetry symmetry)
+{
+  return uint64_t(1) << (4 * formula + symmetry);
+}
+
+// candidates that yield the unique shortest path for some x >= 0, y >= 0, re-derived by sampling in the unit test
+// reedsSheppCanonicalCandidates
+const uint64_t canonical_candidates =
+    candidate_bit(LpSpLp_FORMULA, BASE) | candidate_bit(LpSpRp_FORMULA, BASE) |
+    candidate_bit(LpSpRp_FORMULA, REFLECT) | candidate_bit(LpRmL_FORMULA, REFLECT) |
+    candidate_bit(LpRmL_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRmL_BACKWARDS_FORMULA, TIMEFLIP) |
+    candidate_bit(LpRmL_BACKWARDS_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRupLumRm_FORMULA, BASE) |
+    candidate_bit(LpRupLumRm_FORMULA, TIMEFLIP) | candidate_bit(LpRumLumRp_FORMULA, REFLECT) |
+    candidate_bit(LpRumLumRp_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRmSmLm_FORMULA, REFLECT) |
+    candidate_bit(LpRmSmLm_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRmSmRm_FORMULA, REFLECT) |
+    candidate_bit(LpRmSmRm_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRmSmLm_BACKWARDS_FORMULA, TIMEFLIP) |
+    candidate_bit(LpRmSmLm_BACKWARDS_FORMULA, TIMEFLIP_REFLECT) |
+    candidate_bit(LpRmSmRm_BACKWARDS_FORMULA, TIMEFLIP_REFLECT) | candidate_bit(LpRmSLmRp_FORMULA, REFLECT) |
+    candidate_bit(LpRmSLmRp_FORMULA, TIMEFLIP_REFLECT);
+
+// distance to the boundaries of the quadrant within which the formulas are not symmetric due to rounding errors
+const double canonical_boundary = 1e-9;
+
+/** \brief Returns the shortest path evaluating only the canonical candidates: the timeflip and reflect of the
+    canonical formulas are evaluated directly in the original configuration, which yields the segment lengths and
+    types of the original path. Close to the boundaries, the candidates of the adjacent quadrants are added. */
+Reeds_Shepp_State_Space::Reeds_Shepp_Path reeds_shepp_canonical(double x, double y, double phi)
+{
+  if (!std::isfinite(x + y + phi))
+    return reeds_shepp(x, y, phi);
+  double xc = x, yc = y, phic = phi;
+  int flip = canonicalize(xc, yc, phic);
+  uint64_t candidates = uncanonicalize(canonical_candidates, flip);
+  if (xc < canonical_boundary)
+    candidates |= uncanonicalize(canonical_candidates, flip ^ 1);
+  if (yc < canonical_boundary)
+    candidates |= uncanonicalize(canonical_candidates, flip ^ 2);
+  if (xc < canonical_boundary && yc < canonical_boundary)
+    candidates |= uncanonicalize(canonical_candidates, flip ^ 3);
+  Reeds_Shepp_State_Space::Reeds_Shepp_Path path = reeds_shepp(x, y, phi, candidates);
+  if (path.length() == numeric_limits<double>::max())
+    return reeds_shepp(x, y, phi);
+  return path;
+}
+
+/** \brief Returns the path of a single candidate (not instrumented) */
+Reeds_Shepp_State_Space::Reeds_Shepp_Path reeds_shepp_candidate(double x, double y, double phi, int candidate)
 {
   Reeds_Shepp_State_Space::Reeds_Shepp_Path path;
-  CSC(x, y, phi, path);
-  CCC(x, y, phi, path);
-  CCCC(x, y, phi, path);
-  CCSC(x, y, phi, path);
-  CCSCC(x, y, phi, path);
+  if (candidate < 8)
+    CSC(x, y, phi, 1u << candidate, path);
+  else if (candidate < 16)
+    CCC(x, y, phi, 1u << (candidate - 8), path);
+  else if (candidate < 24)
+    CCCC(x, y, phi, 1u << (candidate - 16), path);
+  else if (candidate < 40)
+    CCSC(x, y, phi, 1u << (candidate - 24), path);
+  else
+    CCSCC(x, y, phi, 1u << (candidate - 40), path);
+  return path;
+}
+
+/** \brief Returns the candidates within a tolerance of the shortest path length (ties are resolved by rounding errors
+    in the exhaustive search) */
+uint64_t near_shortest_candidates(double x, double y, double phi)
+{
+  double length[nb_candidates], min_length = numeric_limits<double>::max();
+  for (int i = 0; i < nb_candidates; i++)
+  {
+    length[i] = reeds_shepp_candidate(x, y, phi, i).length();
+    min_length = min(min_length, length[i]);
+  }
+  uint64_t candidates = 0;
+  for (int i = 0; i < nb_candidates; i++)
+    if (length[i] - min_length <= 1e-9 * (1. + min_length))
+      candidates |= uint64_t(1) << i;
+  return candidates;
+}
+
+// resolution of the partition grid, compactification of the distance and max. number of candidates of a cell that
+// is not evaluated exhaustively
+const int nb_s = 32, nb_psi = 16, nb_phi = 64;
+const double r0 = 4.;
+const int max_cell_candidates = 4;
+
+/** \brief
+    Partition of the configuration space into the domains of the candidates that yield the shortest path, following
+    the idea of P. Souères and J.-P. Laumond. Instead of the analytic domain boundaries, the partition is sampled once
+    on a grid: the configurations are mapped to x >= 0, y >= 0 by the timeflip and reflect symmetries (which permute
+    the candidates within each group of four), the distance r is compactified to s = r / (r + r0) and the vertices of
+    the grid over (s, atan2(y, x), phi) store all candidates within a tolerance of the shortest path length. A cell
+    evaluates the candidates of its vertices and of the vertices of the adjacent cells; cells near domain boundaries,
+    where more than max_cell_candidates meet, fall back to the exhaustive search.
+    */
+class Reeds_Shepp_Partition
+{
+public:
+  /** \brief Constructor, samples the partition */
+  Reeds_Shepp_Partition()
+  {
+    const int nb_vertices = (nb_s + 1) * (nb_psi + 1) * (nb_phi + 1);
+    vector<uint64_t> vertex_candidates(nb_vertices);
+    for (int i = 0; i <= nb_s; i++)
+      for (int j = 0; j <= nb_psi; j++)
+        for (int k = 0; k <= nb_phi; k++)
+        {
+          // the vertices at s = 1 are represented by a distant configuration
+          double s = min(double(i) / nb_s, 1. - 1e-6), r = r0 * s / (1. - s), psi = .5 * pi * j / nb_psi;
+          double phi = -pi + twopi * k / nb_phi;
+          vertex_candidates[vertex(i, j, k)] = near_shortest_candidates(r * cos(psi), r * sin(psi), phi);
+        }
+
+    cells_.resize(nb_s * nb_psi * nb_phi);
+    for (int i = 0; i < nb_s; i++)
+      for (int j = 0; j < nb_psi; j++)
+        for (int k = 0; k < nb_phi; k++)
+        {
+          uint64_t candidates = 0;
+          for (int a = max(i - 1, 0); a <= min(i + 2, nb_s); a++)
+            for (int b = max(j - 1, 0); b <= min(j + 2, nb_psi); b++)
+              for (int c = k - 1; c <= k + 2; c++)
+                candidates |= vertex_candidates[vertex(a, b, (c + nb_phi) % nb_phi)];
+          if (__builtin_popcountll(candidates) > max_cell_candidates)
+            candidates = all_candidates;
+          // the distinct sets of candidates are stored once
+          size_t index = find(candidates_.begin(), candidates_.end(), candidates) - candidates_.begin();
+          if (index == candidates_.size())
+            candidates_.push_back(candidates);
+          cells_[(i * nb_psi + j) * nb_phi + k] = index;
+        }
+  }
+
+  /** \brief Returns the candidates that have to be evaluated for the configuration (x, y, phi) */
+  uint64_t candidates(double x, double y, double phi) const
+  {
+    if (!std::isfinite(x + y + phi))
+      return all_candidates;
+    int flip = canonicalize(x, y, phi);
+    double r = sqrt(x * x + y * y);
+    int i = min(int(r / (r + r0) * nb_s), nb_s - 1);
+    int j = min(int(atan2(y, x) / (.5 * pi) * nb_psi), nb_psi - 1);
+    int k = min(max(int((mod2pi(phi) + pi) / twopi * nb_phi), 0), nb_phi - 1);
+    return uncanonicalize(candidates_[cells_[(i * nb_psi + j) * nb_phi + k]], flip);
+  }
+
+private:
+  int vertex(int i, int j, int k) const
+  {
+    return (i * (nb_psi + 1) + j) * (nb_phi + 1) + k;
+  }
+
+  /** \brief Distinct sets of candidates */
+  vector<uint64_t> candidates_;
+
+  /** \brief Index into candidates_ for each cell */
+  vector<uint16_t> cells_;
+};
+
+/** \brief Returns the partition shared by all state spaces, it is sampled on the first call */
+const Reeds_Shepp_Partition &reeds_shepp_partition()
+{
+  static const Reeds_Shepp_Partition partition;
+  return partition;
+}
+
+Reeds_Shepp_State_Space::Reeds_Shepp_Path reeds_shepp_partition(double x, double y, double phi)
+{
+  uint64_t candidates = reeds_shepp_partition().candidates(x, y, phi);
+  Reeds_Shepp_State_Space::Reeds_Shepp_Path path = reeds_shepp(x, y, phi, candidates);
+  if (candidates != all_candidates && path.length() == numeric_limits<double>::max())
+    return reeds_shepp(x, y, phi);
   return path;
 }
 }
@@ -536,12 +855,36 @@ Reeds_Shepp_State_Space::Reeds_Shepp_Path::Reeds_Shepp_Path(const Reeds_Shepp_Pa
   total_length_ = fabs(t) + fabs(u) + fabs(v) + fabs(w) + fabs(x);
 }
 
+Reeds_Shepp_State_Space::Reeds_Shepp_State_Space(double kappa, double discretization, Solver solver)
+  : kappa_(kappa), discretization_(discretization), solver_(solver)
+{
+  kappa_inv_ = 1 / kappa;
+  // the partition is sampled here instead of stalling the first query
+  if (solver_ == RS_SOLVER_PARTITION)
+    ::reeds_shepp_partition();
+}
+
+uint64_t Reeds_Shepp_State_Space::get_canonical_candidates()
+{
+  return ::canonical_candidates;
+}
+
+uint64_t Reeds_Shepp_State_Space::get_unique_shortest_candidate(double x, double y, double phi)
+{
+  uint64_t candidates = ::near_shortest_candidates(x, y, phi);
+  return __builtin_popcountll(candidates) == 1 ? candidates : 0;
+}
+
 Reeds_Shepp_State_Space::Reeds_Shepp_Path Reeds_Shepp_State_Space::reeds_shepp(const State &state1,
                                                                                const State &state2) const
 {
   double dx = state2.x - state1.x, dy = state2.y - state1.y, dth = state2.theta - state1.theta;
   double c = cos(state1.theta), s = sin(state1.theta);
   double x = c * dx + s * dy, y = -s * dx + c * dy;
+  if (solver_ == RS_SOLVER_PARTITION)
+    return ::reeds_shepp_partition(x * kappa_, y * kappa_, dth);
+  if (solver_ == RS_SOLVER_CANONICAL)
+    return ::reeds_shepp_canonical(x * kappa_, y * kappa_, dth);
   return ::reeds_shepp(x * kappa_, y * kappa_, dth);
 }
 
@@ -550,6 +893,77 @@ double Reeds_Shepp_State_Space::get_distance(const State &state1, const State &s
   return kappa_inv_ * this->reeds_shepp(state1, state2).length();
 }
 
+void Reeds_Shepp_State_Space::get_distances(const State &state1, const State *states2, size_t n,
+                                            double *distances) const
+{
+  double c = cos(state1.theta), s = sin(state1.theta);
+  for (size_t i = 0; i < n; i++)
+  {
+    double dx = states2[i].x - state1.x, dy = states2[i].y - state1.y, dth = states2[i].theta - state1.theta;
+    double x = c * dx + s * dy, y = -s * dx + c * dy;
+    if (solver_ == RS_SOLVER_PARTITION)
+      distances[i] = kappa_inv_ * ::reeds_shepp_partition(x * kappa_, y * kappa_, dth).length();
+    else if (solver_ == RS_SOLVER_CANONICAL)
+      distances[i] = kappa_inv_ * ::reeds_shepp_canonical(x * kappa_, y * kappa_, dth).length();
+    else
+      distances[i] = kappa_inv_ * ::reeds_shepp(x * kappa_, y * kappa_, dth).length();
+  }
+}
+
+void Reeds_Shepp_State_Space::get_pairwise_distances(const double *x1, const double *y1, const double *theta1,
+                                                     const double *x2, const double *y2, const double *theta2,
+                                                     size_t n, double *distances) const
+{
+  // transform the pairs into the frame of the first state in blocks on the stack
+  const size_t block_size = 256;
+  double x[block_size], y[block_size], phi[block_size];
+  Batch_Instruction_Set instruction_set = get_batch_instruction_set();
+  for (size_t i = 0; i < n; i += block_size)
+  {
+    size_t m = min(block_size, n - i);
+    for (size_t j = 0; j < m; j++)
+    {
+      double dx = x2[i + j] - x1[i + j], dy = y2[i + j] - y1[i + j];
+      double c = cos(theta1[i + j]), s = sin(theta1[i + j]);
+      x[j] = (c * dx + s * dy) * kappa_;
+      y[j] = (-s * dx + c * dy) * kappa_;
+      phi[j] = theta2[i + j] - theta1[i + j];
+    }
+    reeds_shepp_lengths(x, y, phi, m, distances + i, instruction_set);
+    for (size_t j = 0; j < m; j++)
+      distances[i + j] *= kappa_inv_;
+  }
+}
+
+void Reeds_Shepp_State_Space::reeds_shepp_lengths(const double *x, const double *y, const double *phi, size_t n,
+                                                  double *lengths, Batch_Instruction_Set instruction_set)
+{
+  instruction_set = min(instruction_set, get_batch_instruction_set());
+  if (instruction_set == RS_BATCH_AVX512)
+    reeds_shepp_batch::avx512_lengths(x, y, phi, n, lengths);
+  else if (instruction_set == RS_BATCH_AVX2)
+    reeds_shepp_batch::avx2_lengths(x, y, phi, n, lengths);
+  else
+    for (size_t i = 0; i < n; i++)
+      lengths[i] = ::reeds_shepp(x[i], y[i], phi[i]).length();
+}
+
+Reeds_Shepp_State_Space::Batch_Instruction_Set Reeds_Shepp_State_Space::get_batch_instruction_set()
+{
+  // the CPU is queried once
+  static const Batch_Instruction_Set instruction_set = []() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (reeds_shepp_batch::avx512_lengths && __builtin_cpu_supports("avx512f"))
+      return RS_BATCH_AVX512;
+    if (reeds_shepp_batch::avx2_lengths && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return RS_BATCH_AVX2;
+#endif
+    return RS_BATCH_SCALAR;
+  }();
+  return instruction_set;
+}
+
 vector<Control> Reeds_Shepp_State_Space::get_controls(const State &state1, const State &state2) const
 {
   vector<Control> reeds_shepp_controls;
@@ -586,7 +1000,59 @@ vector<Control> Reeds_Shepp_State_Space::get_controls(const State &state1, const
 vector<State> Reeds_Shepp_State_Space::get_path(const State &state1, const State &state2) const
 {
   vector<Control> reeds_shepp_controls = this->get_controls(state1, state2);
-  return this->forward_euler(state1, reeds_shepp_controls);
+  return this->integrate(state1, reeds_shepp_controls);
+}
+
+Path_Range Reeds_Shepp_State_Space::get_path_range(const State &state1, const State &state2) const
+{
+  return this->get_path_range(state1, this->get_controls(state1, state2));
+}
+
+Path_Range Reeds_Shepp_State_Space::get_path_range(const State &state,
+                                                   const vector<Control> &reeds_shepp_controls) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range(state, reeds_shepp_controls, discretization_, convention);
+}
+
+State Reeds_Shepp_State_Space::state_at(const State &state, const vector<Control> &reeds_shepp_controls,
+                                        double s) const
+{
+  return this->get_path_range(state, reeds_shepp_controls).state_at(s);
+}
+
+void Reeds_Shepp_State_Space::states_at(const State &state, const vector<Control> &reeds_shepp_controls,
+                                        const double *s, size_t n, State *states) const
+{
+  this->get_path_range(state, reeds_shepp_controls).states_at(s, n, states);
+}
+
+size_t Reeds_Shepp_State_Space::sample_path(const State &state, const vector<Control> &reeds_shepp_controls,
+                                            double *x, double *y, double *theta, double *kappa, double *d,
+                                            size_t capacity) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample(state, reeds_shepp_controls, discretization_, convention, x, y, theta, kappa, d, capacity);
+}
+
+vector<State> Reeds_Shepp_State_Space::integrate(const State &state, const vector<Control> &reeds_shepp_controls) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample(state, reeds_shepp_controls, discretization_, convention);
+}
+
+vector<State> Reeds_Shepp_State_Space::get_path_adaptive(const State &state1, const State &state2,
+                                                         double tolerance) const
+{
+  return this->integrate_adaptive(state1, this->get_controls(state1, state2), tolerance);
+}
+
+vector<State> Reeds_Shepp_State_Space::integrate_adaptive(const State &state,
+                                                          const vector<Control> &reeds_shepp_controls,
+                                                          double tolerance) const
+{
+  Path_Range::Convention convention = { mod2pi, false };
+  return Path_Range::sample_adaptive(state, reeds_shepp_controls, tolerance, convention);
 }
 
 vector<State> Reeds_Shepp_State_Space::forward_euler(const State &state,
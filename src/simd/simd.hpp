@@ -0,0 +1,247 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cmath>
+
+/* This private header (not installed) is only included by the translation units that are compiled for a specific
+   instruction set (see simd_avx2.hpp and simd_avx512.hpp). Everything is kept in an anonymous namespace so that the instantiations of the
+   different instruction sets cannot be merged by the linker. */
+namespace
+{
+/** \brief
+    Packed doubles of an instruction set Isa, which has to provide the types Value and Mask, the number of lanes
+    WIDTH and the static functions used below.
+    */
+template <typename Isa>
+struct Vec
+{
+  typedef typename Isa::Value Value;
+
+  Vec()
+  {
+  }
+  Vec(Value _v) : v(_v)
+  {
+  }
+  Vec(double a) : v(Isa::set1(a))
+  {
+  }
+
+  friend Vec operator+(const Vec &a, const Vec &b)
+  {
+    return Isa::add(a.v, b.v);
+  }
+  friend Vec operator-(const Vec &a, const Vec &b)
+  {
+    return Isa::sub(a.v, b.v);
+  }
+  friend Vec operator*(const Vec &a, const Vec &b)
+  {
+    return Isa::mul(a.v, b.v);
+  }
+  friend Vec operator/(const Vec &a, const Vec &b)
+  {
+    return Isa::div(a.v, b.v);
+  }
+  friend Vec operator-(const Vec &a)
+  {
+    return Isa::neg(a.v);
+  }
+
+  Value v;
+};
+
+/** \brief Lane mask of an instruction set Isa */
+template <typename Isa>
+struct Mask
+{
+  typedef typename Isa::Mask Value;
+
+  Mask(Value _m) : m(_m)
+  {
+  }
+
+  friend Mask operator&(const Mask &a, const Mask &b)
+  {
+    return Isa::mask_and(a.m, b.m);
+  }
+  friend Mask operator|(const Mask &a, const Mask &b)
+  {
+    return Isa::mask_or(a.m, b.m);
+  }
+
+  Value m;
+};
+
+template <typename Isa>
+Mask<Isa> operator<(const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::lt(a.v, b.v);
+}
+template <typename Isa>
+Mask<Isa> operator<=(const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::le(a.v, b.v);
+}
+template <typename Isa>
+Mask<Isa> operator>(const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::lt(b.v, a.v);
+}
+template <typename Isa>
+Mask<Isa> operator>=(const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::le(b.v, a.v);
+}
+template <typename Isa>
+Mask<Isa> operator==(const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::eq(a.v, b.v);
+}
+
+/** \brief Lane-wise m ? a : b */
+template <typename Isa>
+Vec<Isa> select(const Mask<Isa> &m, const Vec<Isa> &a, const Vec<Isa> &b)
+{
+  return Isa::select(m.m, a.v, b.v);
+}
+template <typename Isa>
+Vec<Isa> fabs(const Vec<Isa> &a)
+{
+  return Isa::abs(a.v);
+}
+template <typename Isa>
+Vec<Isa> sqrt(const Vec<Isa> &a)
+{
+  return Isa::sqrt(a.v);
+}
+template <typename Isa>
+Vec<Isa> floor(const Vec<Isa> &a)
+{
+  return Isa::floor(a.v);
+}
+template <typename Isa>
+Vec<Isa> round(const Vec<Isa> &a)
+{
+  return Isa::round(a.v);
+}
+template <typename Isa>
+Vec<Isa> trunc(const Vec<Isa> &a)
+{
+  return Isa::trunc(a.v);
+}
+/** \brief c - a * b with a single rounding */
+template <typename Isa>
+Vec<Isa> fnmadd(const Vec<Isa> &a, const Vec<Isa> &b, const Vec<Isa> &c)
+{
+  return Isa::fnmadd(a.v, b.v, c.v);
+}
+/** \brief Lanes with the sign bit set (including -0.0) */
+template <typename Isa>
+Mask<Isa> signbit(const Vec<Isa> &a)
+{
+  return Isa::signbit(a.v);
+}
+
+/** \brief Sine and cosine, the polynomials are taken from the Cephes library (relative error < 2e-16) */
+template <typename Isa>
+void sincos(const Vec<Isa> &x, Vec<Isa> &s, Vec<Isa> &c)
+{
+  typedef Vec<Isa> V;
+  static const double sin_coeffs[] = { 1.58962301576546568060E-10, -2.50507477628578072866E-8,
+                                       2.75573136213857245213E-6,  -1.98412698295895385996E-4,
+                                       8.33333333332211858878E-3,  -1.66666666666666307295E-1 };
+  static const double cos_coeffs[] = { -1.13585365213876817300E-11, 2.08757008419747316778E-9,
+                                       -2.75573141792967388112E-7,  2.48015872888517045348E-5,
+                                       -1.38888888888730564116E-3,  4.16666666666665929218E-2 };
+  // reduction to r in [-pi/4, pi/4] and quadrant q
+  V q = round(x * V(M_2_PI));
+  V r = fnmadd(q, V(1.57079632679489655800E0), x);
+  r = fnmadd(q, V(6.12323399573676603587E-17), r);
+  V z = r * r;
+  V ps = V(sin_coeffs[0]), pc = V(cos_coeffs[0]);
+  for (int i = 1; i < 6; i++)
+  {
+    ps = ps * z + V(sin_coeffs[i]);
+    pc = pc * z + V(cos_coeffs[i]);
+  }
+  V sin_r = r + r * z * ps;
+  V cos_r = V(1.) - V(.5) * z + z * z * pc;
+  // quadrant as fraction of 4: 0, .25, .5, .75
+  V f = q * V(.25);
+  f = f - floor(f);
+  Mask<Isa> odd = (f == V(.25)) | (f == V(.75));
+  s = select(odd, cos_r, sin_r);
+  c = select(odd, sin_r, cos_r);
+  s = select(f >= V(.5), -s, s);
+  c = select((f == V(.25)) | (f == V(.5)), -c, c);
+}
+
+/** \brief Arc tangent of y / x in [-pi, pi] with the sign conventions of the C library, the rational approximation
+    is taken from the Cephes library */
+template <typename Isa>
+Vec<Isa> atan2(const Vec<Isa> &y, const Vec<Isa> &x)
+{
+  typedef Vec<Isa> V;
+  static const double p_coeffs[] = { -8.750608600031904122785E-1, -1.615753718733365076637E1,
+                                     -7.500855792314704667340E1, -1.228866684490136173410E2,
+                                     -6.485021904942025371773E1 };
+  static const double q_coeffs[] = { 2.485846490142306297962E1, 1.650270098316988542046E2,
+                                     4.328810604912902668951E2, 4.853903996359136964868E2,
+                                     1.945506571482613964425E2 };
+  static const double more_bits = 6.123233995736765886130E-17;
+  V ax = fabs(x), ay = fabs(y);
+  Mask<Isa> swap = ay > ax;
+  V num = select(swap, ax, ay), den = select(swap, ay, ax);
+  V a = select(den == V(0.), V(0.), num / den);
+  // reduction to [0, 0.66]
+  Mask<Isa> big = a > V(.66);
+  V t = select(big, (a - V(1.)) / (a + V(1.)), a);
+  V z = t * t;
+  V p = V(p_coeffs[0]), q = z + V(q_coeffs[0]);
+  for (int i = 1; i < 5; i++)
+  {
+    p = p * z + V(p_coeffs[i]);
+    q = q * z + V(q_coeffs[i]);
+  }
+  V r = t * (z * p / q) + t;
+  r = select(big, V(M_PI_4) + (r + V(.5 * more_bits)), r);
+  // quadrants
+  r = select(swap, (V(M_PI_2) - r) + V(more_bits), r);
+  r = select(signbit(x), (V(M_PI) - r) + V(2. * more_bits), r);
+  return select(signbit(y), -r, r);
+}
+
+/** \brief Arc sine, NaN outside of [-1, 1] */
+template <typename Isa>
+Vec<Isa> asin(const Vec<Isa> &x)
+{
+  return atan2(x, sqrt((Vec<Isa>(1.) - x) * (Vec<Isa>(1.) + x)));
+}
+
+/** \brief Arc cosine, NaN outside of [-1, 1] */
+template <typename Isa>
+Vec<Isa> acos(const Vec<Isa> &x)
+{
+  return atan2(sqrt((Vec<Isa>(1.) - x) * (Vec<Isa>(1.) + x)), x);
+}
+}
+
+#endif
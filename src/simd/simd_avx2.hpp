@@ -0,0 +1,122 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef SIMD_AVX2_HPP
+#define SIMD_AVX2_HPP
+
+/* Only to be included by translation units compiled with -mavx2 -mfma. */
+#include <immintrin.h>
+
+#include "simd/simd.hpp"
+
+namespace
+{
+/** \brief 4 packed doubles (AVX2 + FMA) */
+struct Avx2
+{
+  typedef __m256d Value;
+  typedef __m256d Mask;
+  static const int WIDTH = 4;
+
+  static Value set1(double a)
+  {
+    return _mm256_set1_pd(a);
+  }
+  static Value load(const double *p)
+  {
+    return _mm256_loadu_pd(p);
+  }
+  static void store(double *p, Value a)
+  {
+    _mm256_storeu_pd(p, a);
+  }
+  static Value add(Value a, Value b)
+  {
+    return _mm256_add_pd(a, b);
+  }
+  static Value sub(Value a, Value b)
+  {
+    return _mm256_sub_pd(a, b);
+  }
+  static Value mul(Value a, Value b)
+  {
+    return _mm256_mul_pd(a, b);
+  }
+  static Value div(Value a, Value b)
+  {
+    return _mm256_div_pd(a, b);
+  }
+  static Value fnmadd(Value a, Value b, Value c)
+  {
+    return _mm256_fnmadd_pd(a, b, c);
+  }
+  static Value neg(Value a)
+  {
+    return _mm256_xor_pd(a, _mm256_set1_pd(-0.));
+  }
+  static Value abs(Value a)
+  {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.), a);
+  }
+  static Value sqrt(Value a)
+  {
+    return _mm256_sqrt_pd(a);
+  }
+  static Value floor(Value a)
+  {
+    return _mm256_round_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  }
+  static Value round(Value a)
+  {
+    return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  static Value trunc(Value a)
+  {
+    return _mm256_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+  static Mask lt(Value a, Value b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+  }
+  static Mask le(Value a, Value b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+  }
+  static Mask eq(Value a, Value b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+  }
+  static Mask signbit(Value a)
+  {
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_castpd_si256(a)));
+  }
+  static Mask mask_and(Mask a, Mask b)
+  {
+    return _mm256_and_pd(a, b);
+  }
+  static Mask mask_or(Mask a, Mask b)
+  {
+    return _mm256_or_pd(a, b);
+  }
+  static Value select(Mask m, Value a, Value b)
+  {
+    return _mm256_blendv_pd(b, a, m);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+***********************************************************************/
+
+#ifndef SIMD_AVX512_HPP
+#define SIMD_AVX512_HPP
+
+/* Only to be included by translation units compiled with -mavx512f -mfma. */
+#include <immintrin.h>
+
+#include "simd/simd.hpp"
+
+namespace
+{
+/** \brief 8 packed doubles (AVX-512F) */
+struct Avx512
+{
+  typedef __m512d Value;
+  typedef __mmask8 Mask;
+  static const int WIDTH = 8;
+
+  static Value set1(double a)
+  {
+    return _mm512_set1_pd(a);
+  }
+  static Value load(const double *p)
+  {
+    return _mm512_loadu_pd(p);
+  }
+  static void store(double *p, Value a)
+  {
+    _mm512_storeu_pd(p, a);
+  }
+  static Value add(Value a, Value b)
+  {
+    return _mm512_add_pd(a, b);
+  }
+  static Value sub(Value a, Value b)
+  {
+    return _mm512_sub_pd(a, b);
+  }
+  static Value mul(Value a, Value b)
+  {
+    return _mm512_mul_pd(a, b);
+  }
+  static Value div(Value a, Value b)
+  {
+    return _mm512_div_pd(a, b);
+  }
+  static Value fnmadd(Value a, Value b, Value c)
+  {
+    return _mm512_fnmadd_pd(a, b, c);
+  }
+  static Value neg(Value a)
+  {
+    return _mm512_castsi512_pd(
+        _mm512_xor_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(_mm512_set1_pd(-0.))));
+  }
+  static Value abs(Value a)
+  {
+    return _mm512_abs_pd(a);
+  }
+  static Value sqrt(Value a)
+  {
+    return _mm512_sqrt_pd(a);
+  }
+  static Value floor(Value a)
+  {
+    return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  }
+  static Value round(Value a)
+  {
+    return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+  static Value trunc(Value a)
+  {
+    return _mm512_roundscale_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+  static Mask lt(Value a, Value b)
+  {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+  }
+  static Mask le(Value a, Value b)
+  {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ);
+  }
+  static Mask eq(Value a, Value b)
+  {
+    return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+  }
+  static Mask signbit(Value a)
+  {
+    return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(a), _mm512_setzero_si512());
+  }
+  static Mask mask_and(Mask a, Mask b)
+  {
+    return a & b;
+  }
+  static Mask mask_or(Mask a, Mask b)
+  {
+    return a | b;
+  }
+  static Value select(Mask m, Value a, Value b)
+  {
+    return _mm512_mask_blend_pd(m, b, a);
+  }
+};
+}
+
+#endif
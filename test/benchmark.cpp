@@ -0,0 +1,216 @@
+/*********************************************************************
+*  Copyright (c) 2017 Robert Bosch GmbH.
+*  All rights reserved.
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+* *********************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "steering_functions/dubins_state_space/dubins_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/cc_dubins_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/cc_reeds_shepp_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/hc00_reeds_shepp_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/hc0pm_reeds_shepp_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/hcpm0_reeds_shepp_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/hcpmpm_reeds_shepp_state_space.hpp"
+#include "steering_functions/reeds_shepp_state_space/reeds_shepp_state_space.hpp"
+#include "steering_functions/steering_functions.hpp"
+
+using namespace std;
+using namespace steer;
+
+#define KAPPA 1.0                        // [1/m]
+#define SIGMA 1.0                        // [1/m^2]
+#define DISCRETIZATION 0.1               // [m]
+#define WORKLOAD_SIZE 1000               // [-]
+#define WORKLOAD_SEED 0                  // [-]
+#define LATENCY_STRIDE 8                 // [-]
+#define OPERATING_REGION_X 20.0          // [m]
+#define OPERATING_REGION_Y 20.0          // [m]
+#define OPERATING_REGION_THETA 2 * M_PI  // [rad]
+
+atomic<size_t> nb_allocations(0);
+
+void* operator new(size_t size)
+{
+  nb_allocations++;
+  void* p = malloc(size);
+  if (!p)
+    throw bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+// fixed pairs of random start and goal states, identical for every state space and run
+const vector<pair<State, State>>& get_workload()
+{
+  static const vector<pair<State, State>> workload = [] {
+    mt19937 generator(WORKLOAD_SEED);
+    uniform_real_distribution<double> x(-OPERATING_REGION_X / 2.0, OPERATING_REGION_X / 2.0);
+    uniform_real_distribution<double> y(-OPERATING_REGION_Y / 2.0, OPERATING_REGION_Y / 2.0);
+    uniform_real_distribution<double> theta(-OPERATING_REGION_THETA / 2.0, OPERATING_REGION_THETA / 2.0);
+    vector<pair<State, State>> states(WORKLOAD_SIZE);
+    for (auto& state_pair : states)
+    {
+      state_pair.first = { x(generator), y(generator), theta(generator), 0.0, 0.0 };
+      state_pair.second = { x(generator), y(generator), theta(generator), 0.0, 0.0 };
+    }
+    return states;
+  }();
+  return workload;
+}
+
+// value of a sorted vector at a percentile
+double get_percentile(const vector<double>& sorted, double percentile)
+{
+  if (sorted.empty())
+    return 0.0;
+  size_t index = static_cast<size_t>(percentile / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+// runs a query over the workload, the latency of every LATENCY_STRIDE-th query is recorded for the percentiles so
+// that the clock overhead hardly affects the mean time per query
+template <typename State_Space, typename Query>
+void run_queries(benchmark::State& state, const State_Space& state_space, Query query)
+{
+  const vector<pair<State, State>>& workload = get_workload();
+  vector<double> latencies;
+  latencies.reserve(1 << 20);
+  size_t i = 0;
+  size_t allocations = nb_allocations;
+  for (auto _ : state)
+  {
+    const pair<State, State>& states = workload[i % workload.size()];
+    if (i++ % LATENCY_STRIDE == 0 && latencies.size() < latencies.capacity())
+    {
+      auto clock_start = chrono::steady_clock::now();
+      benchmark::DoNotOptimize(query(state_space, states.first, states.second));
+      latencies.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - clock_start).count());
+    }
+    else
+      benchmark::DoNotOptimize(query(state_space, states.first, states.second));
+  }
+  state.counters["allocs/op"] =
+      benchmark::Counter(static_cast<double>(nb_allocations - allocations), benchmark::Counter::kAvgIterations);
+  sort(latencies.begin(), latencies.end());
+  state.counters["p50_ns"] = get_percentile(latencies, 50.0);
+  state.counters["p90_ns"] = get_percentile(latencies, 90.0);
+  state.counters["p99_ns"] = get_percentile(latencies, 99.0);
+}
+
+// runs get_distance and get_controls in separate passes over the workload, reports the mean time per query of both
+// and the speedup of get_distance; every distance has to equal the length of the controls up to rounding
+template <typename State_Space>
+void compare_distance_controls(benchmark::State& state, const State_Space& state_space)
+{
+  const vector<pair<State, State>>& workload = get_workload();
+  vector<double> distances(workload.size()), lengths(workload.size());
+  chrono::duration<double, nano> distance_time(0), controls_time(0);
+  size_t nb_mismatches = 0;
+  for (auto _ : state)
+  {
+    auto clock_start = chrono::steady_clock::now();
+    for (size_t i = 0; i < workload.size(); i++)
+      distances[i] = state_space.get_distance(workload[i].first, workload[i].second);
+    benchmark::DoNotOptimize(distances.data());
+    distance_time += chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    for (size_t i = 0; i < workload.size(); i++)
+    {
+      vector<Control> controls = state_space.get_controls(workload[i].first, workload[i].second);
+      lengths[i] = 0.0;
+      for (const auto& control : controls)
+        lengths[i] += fabs(control.delta_s);
+    }
+    benchmark::DoNotOptimize(lengths.data());
+    controls_time += chrono::steady_clock::now() - clock_start;
+    for (size_t i = 0; i < workload.size(); i++)
+    {
+      if (fabs(distances[i] - lengths[i]) > 1e-9 * (1.0 + lengths[i]))
+        nb_mismatches++;
+    }
+  }
+  double nb_queries = static_cast<double>(state.iterations() * workload.size());
+  state.counters["distance_ns"] = distance_time.count() / nb_queries;
+  state.counters["controls_ns"] = controls_time.count() / nb_queries;
+  state.counters["speedup"] = controls_time.count() / distance_time.count();
+  state.counters["mismatches"] = static_cast<double>(nb_mismatches);
+}
+
+// registers get_distance, get_controls and get_path of a state space
+template <typename State_Space>
+void register_state_space(const string& name, const State_Space& state_space)
+{
+  benchmark::RegisterBenchmark((name + "/get_distance").c_str(), [&state_space](benchmark::State& state) {
+    run_queries(state, state_space, [](const State_Space& ss, const State& start, const State& goal) {
+      return ss.get_distance(start, goal);
+    });
+  });
+  benchmark::RegisterBenchmark((name + "/get_controls").c_str(), [&state_space](benchmark::State& state) {
+    run_queries(state, state_space, [](const State_Space& ss, const State& start, const State& goal) {
+      return ss.get_controls(start, goal);
+    });
+  });
+  benchmark::RegisterBenchmark((name + "/get_path").c_str(), [&state_space](benchmark::State& state) {
+    run_queries(state, state_space, [](const State_Space& ss, const State& start, const State& goal) {
+      return ss.get_path(start, goal);
+    });
+  });
+  benchmark::RegisterBenchmark((name + "/get_distance_vs_get_controls").c_str(),
+                               [&state_space](benchmark::State& state) {
+                                 compare_distance_controls(state, state_space);
+                               });
+}
+
+int main(int argc, char** argv)
+{
+  CC_Dubins_State_Space cc_dubins_ss(KAPPA, SIGMA, DISCRETIZATION, true);
+  Dubins_State_Space dubins_ss(KAPPA, DISCRETIZATION, true);
+  CC_Reeds_Shepp_State_Space cc_rs_ss(KAPPA, SIGMA, DISCRETIZATION);
+  HC00_Reeds_Shepp_State_Space hc00_ss(KAPPA, SIGMA, DISCRETIZATION);
+  HC0pm_Reeds_Shepp_State_Space hc0pm_ss(KAPPA, SIGMA, DISCRETIZATION);
+  HCpm0_Reeds_Shepp_State_Space hcpm0_ss(KAPPA, SIGMA, DISCRETIZATION);
+  HCpmpm_Reeds_Shepp_State_Space hcpmpm_ss(KAPPA, SIGMA, DISCRETIZATION);
+  Reeds_Shepp_State_Space rs_ss(KAPPA, DISCRETIZATION);
+  register_state_space("CC_Dubins", cc_dubins_ss);
+  register_state_space("Dubins", dubins_ss);
+  register_state_space("CC_Reeds_Shepp", cc_rs_ss);
+  register_state_space("HC00_Reeds_Shepp", hc00_ss);
+  register_state_space("HC0pm_Reeds_Shepp", hc0pm_ss);
+  register_state_space("HCpm0_Reeds_Shepp", hcpm0_ss);
+  register_state_space("HCpmpm_Reeds_Shepp", hcpmpm_ss);
+  register_state_space("Reeds_Shepp", rs_ss);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -17,9 +17,22 @@
 
 #include <gtest/gtest.h>
 #include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
 
+#include "steering_functions/controls_cache/controls_cache.hpp"
+#include "steering_functions/distance_matrix/distance_matrix.hpp"
 #include "steering_functions/dubins_state_space/dubins_state_space.hpp"
 #include "steering_functions/hc_cc_state_space/cc_dubins_state_space.hpp"
 #include "steering_functions/hc_cc_state_space/cc_reeds_shepp_state_space.hpp"
@@ -27,6 +40,9 @@
 #include "steering_functions/hc_cc_state_space/hc0pm_reeds_shepp_state_space.hpp"
 #include "steering_functions/hc_cc_state_space/hcpm0_reeds_shepp_state_space.hpp"
 #include "steering_functions/hc_cc_state_space/hcpmpm_reeds_shepp_state_space.hpp"
+#include "steering_functions/hc_cc_state_space/utilities.hpp"
+#include "steering_functions/heuristic_table/heuristic_table.hpp"
+#include "steering_functions/instrumentation/instrumentation.hpp"
 #include "steering_functions/reeds_shepp_state_space/reeds_shepp_state_space.hpp"
 #include "steering_functions/steering_functions.hpp"
 
@@ -40,10 +56,14 @@ using namespace steer;
 #define SIGMA 1.0                        // [1/m^2]
 #define DISCRETIZATION 0.01              // [m]
 #define SAMPLES 1e5                      // [-]
+#define THREADS 8                        // [-]
 #define OPERATING_REGION_X 20.0          // [m]
 #define OPERATING_REGION_Y 20.0          // [m]
 #define OPERATING_REGION_THETA 2 * M_PI  // [rad]
 #define random(lower, upper) (rand() * (upper - lower) / RAND_MAX + lower)
+#ifndef STEERING_FUNCTIONS_TEST_DIR
+#define STEERING_FUNCTIONS_TEST_DIR "."  // output of the statistics
+#endif
 
 State get_random_state()
 {
@@ -56,6 +76,16 @@ State get_random_state()
   return state;
 }
 
+// returns the state at the pose (dx, dy, dtheta) relative to state
+State get_relative_state(const State& state, double dx, double dy, double dtheta)
+{
+  State relative_state = state;
+  relative_state.x = state.x + cos(state.theta) * dx - sin(state.theta) * dy;
+  relative_state.y = state.y + sin(state.theta) * dx + cos(state.theta) * dy;
+  relative_state.theta = state.theta + dtheta;
+  return relative_state;
+}
+
 double get_distance(const State& state1, const State& state2)
 {
   return sqrt(pow(state2.x - state1.x, 2) + pow(state2.y - state1.y, 2));
@@ -209,6 +239,56 @@ TEST(SteeringFunctions, reachingGoal)
   }
 }
 
+// goal errors of the states computed in closed form (integrate) and incrementally (forward_euler)
+template <typename State_Space>
+void add_goal_errors(const State_Space& state_space, const State& start, const State& goal,
+                     vector<double>& errors_integrate, vector<double>& errors_forward_euler)
+{
+  vector<Control> controls = state_space.get_controls(start, goal);
+  vector<State> path = state_space.integrate(start, controls);
+  vector<State> path_forward_euler = state_space.forward_euler(start, controls);
+  // the states are sampled at the same arc lengths
+  ASSERT_EQ(path.size(), path_forward_euler.size());
+  for (size_t i = 0; i < path.size(); i++)
+    EXPECT_LT(get_distance(path[i], path_forward_euler[i]), EPS_DISTANCE);
+  EXPECT_LT(fabs(pify(path.back().theta - goal.theta)), EPS_YAW);
+  errors_integrate.push_back(get_distance(goal, path.back()));
+  errors_forward_euler.push_back(get_distance(goal, path_forward_euler.back()));
+  // no accumulation of errors along the path, checked where the controls reach the goal (otherwise the goal errors
+  // of both are dominated by the errors of the controls, which the rounding errors of forward_euler may reduce)
+  if (errors_forward_euler.back() < 1e-9)
+    EXPECT_LE(errors_integrate.back(), errors_forward_euler.back() + 1e-12);
+}
+
+TEST(SteeringFunctions, integrationAccuracy)
+{
+  vector<double> errors_integrate, errors_forward_euler;
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 10; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    add_goal_errors(cc_dubins_forwards_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(cc_dubins_backwards_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(dubins_forwards_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(dubins_backwards_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(cc_rs_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(hc00_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(hc0pm_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(hcpm0_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(hcpmpm_ss, start, goal, errors_integrate, errors_forward_euler);
+    add_goal_errors(rs_ss, start, goal, errors_integrate, errors_forward_euler);
+  }
+  EXPECT_LT(get_mean(errors_integrate), get_mean(errors_forward_euler));
+  // the remaining errors are the errors of the controls
+  sort(errors_integrate.begin(), errors_integrate.end());
+  sort(errors_forward_euler.begin(), errors_forward_euler.end());
+  EXPECT_LT(errors_integrate[errors_integrate.size() / 2], 1e-12);
+  cout << "[----------] Goal error median/max. integrate [m]: " << errors_integrate[errors_integrate.size() / 2] << "/"
+       << errors_integrate.back() << ", forward_euler [m]: " << errors_forward_euler[errors_forward_euler.size() / 2]
+       << "/" << errors_forward_euler.back() << endl;
+}
+
 TEST(SteeringFunctions, curvatureContinuity)
 {
   srand(seed);
@@ -301,7 +381,76 @@ TEST(SteeringFunctions, curvatureContinuity)
   }
 }
 
-#include <ros/package.h>
+void append_results(double distance, const vector<Control>& controls, const vector<State>& path,
+                    vector<double>& results)
+{
+  results.push_back(distance);
+  for (const auto& control : controls)
+  {
+    results.push_back(control.delta_s);
+    results.push_back(control.kappa);
+    results.push_back(control.sigma);
+  }
+  results.push_back(path.size());
+  results.push_back(path.back().x);
+  results.push_back(path.back().y);
+  results.push_back(path.back().theta);
+  results.push_back(path.back().kappa);
+}
+
+vector<double> get_results(const vector<State>& starts, const vector<State>& goals)
+{
+  vector<double> results;
+  for (auto start = starts.begin(), goal = goals.begin(); start != starts.end(); ++start, ++goal)
+  {
+    append_results(cc_dubins_forwards_ss.get_distance(*start, *goal), cc_dubins_forwards_ss.get_controls(*start, *goal),
+                   cc_dubins_forwards_ss.get_path(*start, *goal), results);
+    append_results(dubins_forwards_ss.get_distance(*start, *goal), dubins_forwards_ss.get_controls(*start, *goal),
+                   dubins_forwards_ss.get_path(*start, *goal), results);
+    append_results(cc_rs_ss.get_distance(*start, *goal), cc_rs_ss.get_controls(*start, *goal),
+                   cc_rs_ss.get_path(*start, *goal), results);
+    append_results(hc00_ss.get_distance(*start, *goal), hc00_ss.get_controls(*start, *goal),
+                   hc00_ss.get_path(*start, *goal), results);
+    append_results(hc0pm_ss.get_distance(*start, *goal), hc0pm_ss.get_controls(*start, *goal),
+                   hc0pm_ss.get_path(*start, *goal), results);
+    append_results(hcpm0_ss.get_distance(*start, *goal), hcpm0_ss.get_controls(*start, *goal),
+                   hcpm0_ss.get_path(*start, *goal), results);
+    append_results(hcpmpm_ss.get_distance(*start, *goal), hcpmpm_ss.get_controls(*start, *goal),
+                   hcpmpm_ss.get_path(*start, *goal), results);
+    append_results(rs_ss.get_distance(*start, *goal), rs_ss.get_controls(*start, *goal), rs_ss.get_path(*start, *goal),
+                   results);
+  }
+  return results;
+}
+
+TEST(SteeringFunctions, multithreading)
+{
+  srand(seed);
+  vector<State> starts;
+  vector<State> goals;
+  for (int i = 0; i < SAMPLES / 200; i++)
+  {
+    starts.push_back(get_random_state());
+    goals.push_back(get_random_state());
+  }
+
+  // all threads share the same state space instances
+  vector<double> single_threaded_results = get_results(starts, goals);
+  vector<vector<double>> multi_threaded_results(THREADS);
+  vector<thread> threads;
+  for (int i = 0; i < THREADS; i++)
+  {
+    threads.push_back(thread([&, i]() { multi_threaded_results[i] = get_results(starts, goals); }));
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  for (const auto& results : multi_threaded_results)
+  {
+    EXPECT_EQ(single_threaded_results, results);
+  }
+}
 
 struct Statistic
 {
@@ -313,7 +462,7 @@ struct Statistic
 
 void write_to_file(const string& id, const vector<Statistic>& stats)
 {
-  string path_to_output = ros::package::getPath("steering_functions") + "/test/" + id + "_stats.csv";
+  string path_to_output = string(STEERING_FUNCTIONS_TEST_DIR) + "/" + id + "_stats.csv";
   remove(path_to_output.c_str());
   string header = "start,goal,computation_time,path_length";
   fstream f;
@@ -511,6 +660,1361 @@ TEST(SteeringFunctions, stats)
   //  write_to_file(rs_id, rs_stats);
 }
 
+// the distance is the length of the controls up to rounding
+template <typename State_Space>
+void check_controls_length(const State_Space& state_space, const State& start, const State& goal)
+{
+  double length = 0.0;
+  for (const auto& control : state_space.get_controls(start, goal))
+    length += fabs(control.delta_s);
+  EXPECT_NEAR(state_space.get_distance(start, goal), length, 1e-9 * (1.0 + length));
+}
+
+TEST(SteeringFunctions, distanceConsistency)
+{
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 10; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+
+    CC_Dubins_Path* cc_dubins_path = cc_dubins_forwards_ss.cc_dubins(start, goal);
+    EXPECT_EQ(cc_dubins_forwards_ss.get_distance(start, goal), cc_dubins_path->length);
+    delete cc_dubins_path;
+    check_controls_length(cc_dubins_forwards_ss, start, goal);
+    check_controls_length(cc_dubins_backwards_ss, start, goal);
+
+    HC_CC_RS_Path* cc_rs_path = cc_rs_ss.cc_reeds_shepp(start, goal);
+    EXPECT_EQ(cc_rs_ss.get_distance(start, goal), cc_rs_path->length);
+    delete cc_rs_path;
+    check_controls_length(cc_rs_ss, start, goal);
+
+    HC_CC_RS_Path* hc00_path = hc00_ss.hc00_reeds_shepp(start, goal);
+    EXPECT_EQ(hc00_ss.get_distance(start, goal), hc00_path->length);
+    delete hc00_path;
+    check_controls_length(hc00_ss, start, goal);
+
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+    HC_CC_RS_Path* hc0pm_path = hc0pm_ss.hc0pm_reeds_shepp(start, goal);
+    EXPECT_EQ(hc0pm_ss.get_distance(start, goal), hc0pm_path->length);
+    delete hc0pm_path;
+    check_controls_length(hc0pm_ss, start, goal);
+
+    start.kappa = KAPPA * (rand() % 3 - 1);
+    HC_CC_RS_Path* hcpmpm_path = hcpmpm_ss.hcpmpm_reeds_shepp(start, goal);
+    EXPECT_EQ(hcpmpm_ss.get_distance(start, goal), hcpmpm_path->length);
+    delete hcpmpm_path;
+    check_controls_length(hcpmpm_ss, start, goal);
+
+    goal.kappa = 0.0;
+    HC_CC_RS_Path* hcpm0_path = hcpm0_ss.hcpm0_reeds_shepp(start, goal);
+    EXPECT_EQ(hcpm0_ss.get_distance(start, goal), hcpm0_path->length);
+    delete hcpm0_path;
+    check_controls_length(hcpm0_ss, start, goal);
+  }
+}
+
+void print_distance_stats(const string& id, const HC_CC_State_Space& state_space, const vector<State>& starts,
+                          const vector<State>& goals)
+{
+  clock_t clock_start = clock();
+  for (auto start = starts.begin(), goal = goals.begin(); start != starts.end(); ++start, ++goal)
+  {
+    state_space.get_distance(*start, *goal);
+  }
+  double distance_time = double(clock() - clock_start) / CLOCKS_PER_SEC / starts.size();
+  clock_start = clock();
+  for (auto start = starts.begin(), goal = goals.begin(); start != starts.end(); ++start, ++goal)
+  {
+    state_space.get_controls(*start, *goal);
+  }
+  double controls_time = double(clock() - clock_start) / CLOCKS_PER_SEC / starts.size();
+  cout << "[----------] " + id + " mean get_distance [s]: " << distance_time << ", mean get_controls [s]: "
+       << controls_time << endl;
+}
+
+TEST(SteeringFunctions, distanceStats)
+{
+  srand(0);
+  vector<State> starts;
+  vector<State> goals;
+  for (int i = 0; i < SAMPLES / 10; i++)
+  {
+    starts.push_back(get_random_state());
+    goals.push_back(get_random_state());
+  }
+  print_distance_stats("CC_Dubins", cc_dubins_forwards_ss, starts, goals);
+  print_distance_stats("CC_RS", cc_rs_ss, starts, goals);
+  print_distance_stats("HC00", hc00_ss, starts, goals);
+  print_distance_stats("HC0pm", hc0pm_ss, starts, goals);
+  print_distance_stats("HCpm0", hcpm0_ss, starts, goals);
+  print_distance_stats("HCpmpm", hcpmpm_ss, starts, goals);
+}
+
+template <typename T>
+void check_distances(const string& id, const T& state_space, const State& start, const vector<State>& goals)
+{
+  vector<double> distances(goals.size());
+  clock_t clock_start = clock();
+  state_space.get_distances(start, goals.data(), goals.size(), distances.data());
+  double distances_time = double(clock() - clock_start) / CLOCKS_PER_SEC;
+  vector<double> distance(goals.size());
+  clock_start = clock();
+  for (size_t i = 0; i < goals.size(); i++)
+  {
+    distance[i] = state_space.get_distance(start, goals[i]);
+  }
+  double distance_time = double(clock() - clock_start) / CLOCKS_PER_SEC;
+  for (size_t i = 0; i < goals.size(); i++)
+  {
+    EXPECT_EQ(distance[i], distances[i]);
+  }
+  cout << "[----------] " + id + " 1-to-" << goals.size() << " get_distances [s]: " << distances_time
+       << ", get_distance [s]: " << distance_time << endl;
+}
+
+TEST(SteeringFunctions, batchDistance)
+{
+  srand(0);
+  State start = get_random_state();
+  vector<State> goals;
+  for (int i = 0; i < SAMPLES / 10; i++)
+  {
+    goals.push_back(get_random_state());
+  }
+  check_distances("CC_Dubins forwards", cc_dubins_forwards_ss, start, goals);
+  check_distances("CC_Dubins backwards", cc_dubins_backwards_ss, start, goals);
+  check_distances("Dubins forwards", dubins_forwards_ss, start, goals);
+  check_distances("Dubins backwards", dubins_backwards_ss, start, goals);
+  check_distances("CC_RS", cc_rs_ss, start, goals);
+  check_distances("HC00", hc00_ss, start, goals);
+  check_distances("RS", rs_ss, start, goals);
+
+  for (auto& goal : goals)
+  {
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+  }
+  check_distances("HC0pm", hc0pm_ss, start, goals);
+  start.kappa = KAPPA * (rand() % 3 - 1);
+  check_distances("HCpmpm", hcpmpm_ss, start, goals);
+  for (auto& goal : goals)
+  {
+    goal.kappa = 0.0;
+  }
+  check_distances("HCpm0", hcpm0_ss, start, goals);
+}
+
+template <typename T>
+void check_distance_matrix(const T& state_space, const Distance_Matrix& distance_matrix, const vector<State>& starts,
+                           const vector<State>& goals)
+{
+  vector<double> distances(starts.size() * goals.size());
+  distance_matrix.compute(state_space, starts.data(), starts.size(), goals.data(), goals.size(), distances.data());
+  for (size_t i = 0; i < starts.size(); i++)
+  {
+    for (size_t j = 0; j < goals.size(); j++)
+    {
+      EXPECT_EQ(state_space.get_distance(starts[i], goals[j]), distances[i * goals.size() + j]);
+    }
+  }
+}
+
+template <typename T>
+void check_symmetric_distance_matrix(const T& state_space, const Distance_Matrix& distance_matrix,
+                                     const vector<State>& states)
+{
+  size_t n = states.size();
+  vector<double> distances(n * n);
+  distance_matrix.compute_symmetric(state_space, states.data(), n, distances.data());
+  for (size_t i = 0; i < n; i++)
+  {
+    for (size_t j = 0; j < n; j++)
+    {
+      if (i <= j)
+        EXPECT_EQ(state_space.get_distance(states[i], states[j]), distances[i * n + j]);
+      else
+        EXPECT_NEAR(state_space.get_distance(states[i], states[j]), distances[i * n + j], EPS_DISTANCE);
+    }
+  }
+}
+
+TEST(SteeringFunctions, distanceMatrix)
+{
+  srand(seed);
+  vector<State> starts;
+  vector<State> goals;
+  for (int i = 0; i < 70; i++)
+  {
+    starts.push_back(get_random_state());
+  }
+  for (int i = 0; i < 50; i++)
+  {
+    goals.push_back(get_random_state());
+  }
+  Distance_Matrix distance_matrix(4, 16);
+  check_distance_matrix(cc_dubins_forwards_ss, distance_matrix, starts, goals);
+  check_distance_matrix(cc_dubins_backwards_ss, distance_matrix, starts, goals);
+  check_distance_matrix(dubins_forwards_ss, distance_matrix, starts, goals);
+  check_distance_matrix(dubins_backwards_ss, distance_matrix, starts, goals);
+  check_distance_matrix(cc_rs_ss, distance_matrix, starts, goals);
+  check_distance_matrix(hc00_ss, distance_matrix, starts, goals);
+  check_distance_matrix(rs_ss, distance_matrix, starts, goals);
+  check_symmetric_distance_matrix(rs_ss, distance_matrix, starts);
+
+  for (auto& start : starts)
+  {
+    start.kappa = KAPPA * (rand() % 3 - 1);
+  }
+  for (auto& goal : goals)
+  {
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+  }
+  check_distance_matrix(hcpmpm_ss, distance_matrix, starts, goals);
+  check_distance_matrix(hcpm0_ss, distance_matrix, starts, goals);
+  check_distance_matrix(hc0pm_ss, distance_matrix, starts, goals);
+
+  // concurrent calls share the worker threads of the distance matrix
+  vector<thread> threads;
+  for (int i = 0; i < 4; i++)
+    threads.push_back(thread([&]() { check_distance_matrix(rs_ss, distance_matrix, starts, goals); }));
+  for (auto& t : threads)
+    t.join();
+}
+
+TEST(SteeringFunctions, distanceMatrixException)
+{
+  srand(seed);
+  vector<State> states;
+  for (int i = 0; i < 64; i++)
+  {
+    states.push_back(get_random_state());
+  }
+  vector<double> distances(states.size() * states.size());
+  Distance_Matrix distance_matrix(4, 8);
+  // the exception is rethrown on the calling thread whether the calling thread or a worker thread evaluates the
+  // failing tile, afterwards the distance matrix is still usable
+  for (size_t k = 0; k < states.size(); k += 9)
+  {
+    const State* failing_state = &states[k];
+    Distance_Matrix::Distance_Function distance = [failing_state](const State& state1, const State& state2) {
+      if (&state1 == failing_state)
+        throw runtime_error("distance");
+      return get_distance(state1, state2);
+    };
+    EXPECT_THROW(distance_matrix.compute(distance, states.data(), states.size(), states.data(), states.size(),
+                                         distances.data()),
+                 runtime_error);
+  }
+  Distance_Matrix::Distance_Function always_throw = [](const State&, const State&) -> double {
+    throw runtime_error("distance");
+  };
+  EXPECT_THROW(distance_matrix.compute_symmetric(always_throw, states.data(), states.size(), distances.data()),
+               runtime_error);
+  check_symmetric_distance_matrix(rs_ss, distance_matrix, states);
+}
+
+TEST(SteeringFunctions, distanceMatrixStats)
+{
+  srand(0);
+  vector<State> states;
+  for (int i = 0; i < 200; i++)
+  {
+    states.push_back(get_random_state());
+  }
+  vector<double> distances(states.size() * states.size());
+  for (unsigned int nb_threads = 1; nb_threads <= THREADS; nb_threads *= 2)
+  {
+    Distance_Matrix distance_matrix(nb_threads);
+    auto clock_start = chrono::steady_clock::now();
+    distance_matrix.compute(hcpmpm_ss, states.data(), states.size(), states.data(), states.size(), distances.data());
+    chrono::duration<double> full_time = chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    distance_matrix.compute_symmetric(rs_ss, states.data(), states.size(), distances.data());
+    chrono::duration<double> symmetric_time = chrono::steady_clock::now() - clock_start;
+    // an 8 x 8 matrix of Euclidean distances in 4 tiles measures the dispatch to the worker threads
+    Distance_Matrix small_distance_matrix(nb_threads, 4);
+    Distance_Matrix::Distance_Function euclidean_distance = [](const State& state1, const State& state2) {
+      return get_distance(state1, state2);
+    };
+    clock_start = chrono::steady_clock::now();
+    for (int i = 0; i < 1000; i++)
+      small_distance_matrix.compute(euclidean_distance, states.data(), 8, states.data(), 8, distances.data());
+    chrono::duration<double> small_time = chrono::steady_clock::now() - clock_start;
+    cout << "[----------] " << nb_threads << " threads, HCpmpm distances per second: "
+         << distances.size() / full_time.count() << ", RS symmetric distances per second: "
+         << distances.size() / symmetric_time.count() << ", dispatch time [s]: "
+         << small_time.count() / 1000 << endl;
+  }
+}
+
+TEST(SteeringFunctions, reedsSheppBatch)
+{
+  srand(seed);
+  vector<double> x1, y1, theta1, x2, y2, theta2;
+  for (int i = 0; i < SAMPLES / 10 + 3; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    x1.push_back(start.x);
+    y1.push_back(start.y);
+    theta1.push_back(start.theta);
+    x2.push_back(goal.x);
+    y2.push_back(goal.y);
+    theta2.push_back(goal.theta);
+  }
+  size_t n = x1.size();
+  vector<double> distances(n);
+  rs_ss.get_pairwise_distances(x1.data(), y1.data(), theta1.data(), x2.data(), y2.data(), theta2.data(), n,
+                               distances.data());
+  for (size_t i = 0; i < n; i++)
+  {
+    State start = { x1[i], y1[i], theta1[i], 0.0, 0.0 };
+    State goal = { x2[i], y2[i], theta2[i], 0.0, 0.0 };
+    EXPECT_NEAR(rs_ss.get_distance(start, goal), distances[i], 1e-9);
+  }
+
+  // every instruction set supported by this CPU against the scalar implementation
+  vector<double> lengths_scalar(n), lengths(n);
+  Reeds_Shepp_State_Space::reeds_shepp_lengths(x2.data(), y2.data(), theta2.data(), n, lengths_scalar.data(),
+                                               Reeds_Shepp_State_Space::RS_BATCH_SCALAR);
+  for (int i = 0; i <= Reeds_Shepp_State_Space::get_batch_instruction_set(); i++)
+  {
+    auto clock_start = chrono::steady_clock::now();
+    Reeds_Shepp_State_Space::reeds_shepp_lengths(x2.data(), y2.data(), theta2.data(), n, lengths.data(),
+                                                 Reeds_Shepp_State_Space::Batch_Instruction_Set(i));
+    chrono::duration<double> time = chrono::steady_clock::now() - clock_start;
+    for (size_t j = 0; j < n; j++)
+    {
+      EXPECT_NEAR(lengths_scalar[j], lengths[j], 1e-9);
+    }
+    cout << "[----------] RS batch instruction set " << i << " mean reeds_shepp_lengths [s]: " << time.count() / n
+         << endl;
+  }
+}
+
+TEST(SteeringFunctions, dubinsBatch)
+{
+  srand(seed);
+  vector<double> x1, y1, theta1, x2, y2, theta2;
+  for (int i = 0; i < SAMPLES / 10 + 3; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    x1.push_back(start.x);
+    y1.push_back(start.y);
+    theta1.push_back(start.theta);
+    x2.push_back(goal.x);
+    y2.push_back(goal.y);
+    theta2.push_back(goal.theta);
+  }
+  size_t n = x1.size();
+  vector<double> distances(n);
+  for (const Dubins_State_Space* dubins_ss : { &dubins_forwards_ss, &dubins_backwards_ss })
+  {
+    auto clock_start = chrono::steady_clock::now();
+    dubins_ss->get_pairwise_distances(x1.data(), y1.data(), theta1.data(), x2.data(), y2.data(), theta2.data(), n,
+                                      distances.data());
+    chrono::duration<double> batch_time = chrono::steady_clock::now() - clock_start;
+    vector<double> distances_scalar(n);
+    clock_start = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+      State start = { x1[i], y1[i], theta1[i], 0.0, 0.0 };
+      State goal = { x2[i], y2[i], theta2[i], 0.0, 0.0 };
+      distances_scalar[i] = dubins_ss->get_distance(start, goal);
+    }
+    chrono::duration<double> scalar_time = chrono::steady_clock::now() - clock_start;
+    for (size_t i = 0; i < n; i++)
+    {
+      EXPECT_NEAR(distances_scalar[i], distances[i], 1e-9);
+    }
+    cout << "[----------] Dubins mean get_distance [s]: " << scalar_time.count() / n
+         << ", mean get_pairwise_distances [s]: " << batch_time.count() / n << endl;
+  }
+
+  // every instruction set supported by this CPU against the scalar implementation, including degenerate queries
+  vector<double> d(n), alpha(n), beta(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    d[i] = (i % 7 == 0) ? 0.0 : sqrt(pow(x2[i] - x1[i], 2) + pow(y2[i] - y1[i], 2)) * KAPPA;
+    alpha[i] = fmod(theta1[i] + 2 * M_PI, 2 * M_PI);
+    beta[i] = (i % 7 == 0) ? alpha[i] : fmod(theta2[i] + 2 * M_PI, 2 * M_PI);
+  }
+  vector<double> lengths_scalar(n), lengths(n);
+  Dubins_State_Space::dubins_lengths(d.data(), alpha.data(), beta.data(), n, lengths_scalar.data(),
+                                     Dubins_State_Space::DUBINS_BATCH_SCALAR);
+  for (int i = 0; i <= Dubins_State_Space::get_batch_instruction_set(); i++)
+  {
+    auto clock_start = chrono::steady_clock::now();
+    Dubins_State_Space::dubins_lengths(d.data(), alpha.data(), beta.data(), n, lengths.data(),
+                                       Dubins_State_Space::Batch_Instruction_Set(i));
+    chrono::duration<double> time = chrono::steady_clock::now() - clock_start;
+    for (size_t j = 0; j < n; j++)
+    {
+      EXPECT_NEAR(lengths_scalar[j], lengths[j], 1e-9);
+    }
+    cout << "[----------] Dubins batch instruction set " << i << " mean dubins_lengths [s]: " << time.count() / n
+         << endl;
+  }
+}
+
+TEST(SteeringFunctions, dubinsClassification)
+{
+  srand(seed);
+  Dubins_State_Space::reset_classification_counters();
+  chrono::duration<double> time(0);
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    auto clock_start = chrono::steady_clock::now();
+    double distance = dubins_forwards_ss.get_distance(start, goal);
+    time += chrono::steady_clock::now() - clock_start;
+
+    // the classification must not change the result of evaluating all words (the SIMD kernels evaluate all words)
+    double dx = goal.x - start.x, dy = goal.y - start.y, th = atan2(dy, dx);
+    double d = sqrt(dx * dx + dy * dy) * KAPPA;
+    double alpha = fmod(fmod(start.theta - th, 2 * M_PI) + 2 * M_PI, 2 * M_PI);
+    double beta = fmod(fmod(goal.theta - th, 2 * M_PI) + 2 * M_PI, 2 * M_PI);
+    double length;
+    Dubins_State_Space::dubins_lengths(&d, &alpha, &beta, 1, &length);
+    EXPECT_NEAR(distance, length / KAPPA, 1e-9);
+  }
+  Dubins_State_Space::Classification_Counters counters = Dubins_State_Space::get_classification_counters();
+  if (Instrumentation::enabled())
+  {
+    EXPECT_EQ(counters.nb_long_paths + counters.nb_short_paths, static_cast<unsigned long long>(SAMPLES));
+    EXPECT_GT(counters.nb_long_paths, 0u);
+  }
+  else
+    EXPECT_EQ(counters.nb_long_paths + counters.nb_short_paths, 0u);
+  cout << "[----------] Dubins long paths: " << counters.nb_long_paths << ", short paths: " << counters.nb_short_paths
+       << ", mean get_distance [s]: " << time.count() / SAMPLES << endl;
+}
+
+TEST(SteeringFunctions, reedsSheppPartition)
+{
+  // the partition is sampled by the constructor
+  auto clock_start = chrono::steady_clock::now();
+  Reeds_Shepp_State_Space rs_partition_ss(KAPPA, DISCRETIZATION, Reeds_Shepp_State_Space::RS_SOLVER_PARTITION);
+  chrono::duration<double> sampling_time = chrono::steady_clock::now() - clock_start;
+  cout << "[----------] RS partition sampling [s]: " << sampling_time.count() << endl;
+
+  // queries at the scale of the operating region, close to the start and far away
+  const int nb_queries = 20 * SAMPLES;
+  vector<State> starts, goals;
+  starts.reserve(SAMPLES);
+  goals.reserve(SAMPLES);
+  int nb_mismatches = 0;
+  chrono::duration<double> exhaustive_time(0), partition_time(0);
+  srand(seed);
+  for (int i = 0; i < nb_queries; i += SAMPLES)
+  {
+    starts.clear();
+    goals.clear();
+    for (int j = 0; j < SAMPLES; j++)
+    {
+      State start = get_random_state();
+      State goal = get_random_state();
+      double scale = (j % 10 == 0) ? 0.1 : ((j % 10 == 1) ? 100.0 : 1.0);
+      goal.x = start.x + scale * (goal.x - start.x);
+      goal.y = start.y + scale * (goal.y - start.y);
+      starts.push_back(start);
+      goals.push_back(goal);
+    }
+    vector<Reeds_Shepp_State_Space::Reeds_Shepp_Path> exhaustive_paths, partition_paths;
+    exhaustive_paths.reserve(SAMPLES);
+    partition_paths.reserve(SAMPLES);
+    clock_start = chrono::steady_clock::now();
+    for (int j = 0; j < SAMPLES; j++)
+      exhaustive_paths.push_back(rs_ss.reeds_shepp(starts[j], goals[j]));
+    exhaustive_time += chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    for (int j = 0; j < SAMPLES; j++)
+      partition_paths.push_back(rs_partition_ss.reeds_shepp(starts[j], goals[j]));
+    partition_time += chrono::steady_clock::now() - clock_start;
+    for (int j = 0; j < SAMPLES; j++)
+      if (exhaustive_paths[j].length() != partition_paths[j].length())
+        nb_mismatches++;
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  cout << "[----------] RS exhaustive mean reeds_shepp [s]: " << exhaustive_time.count() / nb_queries
+       << ", partition mean reeds_shepp [s]: " << partition_time.count() / nb_queries << endl;
+}
+
+TEST(SteeringFunctions, reedsSheppCanonical)
+{
+  Reeds_Shepp_State_Space rs_canonical_ss(KAPPA, DISCRETIZATION, Reeds_Shepp_State_Space::RS_SOLVER_CANONICAL);
+  // queries at the scale of the operating region, close to the start and far away, and on the boundaries of the
+  // canonical quadrant (goal on the axes of the start, parallel or antiparallel orientation)
+  const int nb_queries = 20 * SAMPLES;
+  vector<State> starts, goals;
+  starts.reserve(SAMPLES);
+  goals.reserve(SAMPLES);
+  int nb_mismatches = 0, nb_misses = 0;
+  chrono::duration<double> exhaustive_time(0), canonical_time(0);
+  srand(seed);
+  for (int i = 0; i < nb_queries; i += SAMPLES)
+  {
+    starts.clear();
+    goals.clear();
+    for (int j = 0; j < SAMPLES; j++)
+    {
+      State start = get_random_state();
+      State goal = get_random_state();
+      double scale = (j % 10 == 0) ? 0.1 : ((j % 10 == 1) ? 100.0 : 1.0);
+      double dx = scale * (goal.x - start.x), dy = scale * (goal.y - start.y), dtheta = goal.theta - start.theta;
+      if (j % 7 == 0)
+        dx = 0.0;
+      else if (j % 7 == 1)
+        dy = 0.0;
+      if (j % 5 == 0)
+        dtheta = (j % 2) ? 0.0 : PI;
+      starts.push_back(start);
+      goals.push_back(get_relative_state(start, dx, dy, dtheta));
+    }
+    vector<Reeds_Shepp_State_Space::Reeds_Shepp_Path> exhaustive_paths, canonical_paths;
+    exhaustive_paths.reserve(SAMPLES);
+    canonical_paths.reserve(SAMPLES);
+    auto clock_start = chrono::steady_clock::now();
+    for (int j = 0; j < SAMPLES; j++)
+      exhaustive_paths.push_back(rs_ss.reeds_shepp(starts[j], goals[j]));
+    exhaustive_time += chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    for (int j = 0; j < SAMPLES; j++)
+      canonical_paths.push_back(rs_canonical_ss.reeds_shepp(starts[j], goals[j]));
+    canonical_time += chrono::steady_clock::now() - clock_start;
+    for (int j = 0; j < SAMPLES; j++)
+    {
+      double length = exhaustive_paths[j].length();
+      if (fabs(canonical_paths[j].length() - length) > 1e-9 * (1.0 + length))
+        nb_mismatches++;
+    }
+    // the segment signs and types of the symmetric formulas reach the goal
+    for (int j = 0; j < SAMPLES; j += 100)
+      if (get_distance(goals[j], rs_canonical_ss.get_path(starts[j], goals[j]).back()) > EPS_DISTANCE)
+        nb_misses++;
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  EXPECT_EQ(nb_misses, 0);
+  cout << "[----------] RS exhaustive mean reeds_shepp [s]: " << exhaustive_time.count() / nb_queries
+       << ", canonical mean reeds_shepp [s]: " << canonical_time.count() / nb_queries << endl;
+}
+
+TEST(SteeringFunctions, reedsSheppCanonicalCandidates)
+{
+  // re-derives the candidates of the canonical solver: the union of the unique shortest candidates over
+  // configurations in the quadrant x >= 0, y >= 0 at distances from 1e-3 to 1e3
+  uint64_t candidates = 0;
+  srand(seed);
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    double r = pow(10.0, random(-3.0, 3.0)), psi = random(0.0, PI / 2.0), phi = random(-PI, PI);
+    candidates |= Reeds_Shepp_State_Space::get_unique_shortest_candidate(r * cos(psi), r * sin(psi), phi);
+  }
+  EXPECT_EQ(candidates, Reeds_Shepp_State_Space::get_canonical_candidates());
+  cout << "[----------] RS canonical candidates: " << __builtin_popcountll(candidates) << endl;
+}
+
+TEST(SteeringFunctions, hcpmpmPruning)
+{
+  HCpmpm_Reeds_Shepp_State_Space hcpmpm_exhaustive_ss(KAPPA, SIGMA, DISCRETIZATION, false);
+  HCpmpm_Reeds_Shepp_State_Space::reset_pruning_counters();
+  int nb_mismatches = 0;
+  chrono::duration<double> exhaustive_time(0), pruned_time(0);
+  srand(seed);
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    start.kappa = KAPPA * (rand() % 3 - 1);
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+    HC_CC_RS_Path_Candidate exhaustive_path, pruned_path;
+    auto clock_start = chrono::steady_clock::now();
+    hcpmpm_exhaustive_ss.hcpmpm_reeds_shepp(start, goal, &exhaustive_path);
+    exhaustive_time += chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    hcpmpm_ss.hcpmpm_reeds_shepp(start, goal, &pruned_path);
+    pruned_time += chrono::steady_clock::now() - clock_start;
+    // the pruning must select the same family with the same length
+    if (exhaustive_path.type != pruned_path.type || exhaustive_path.length != pruned_path.length)
+      nb_mismatches++;
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  HCpmpm_Reeds_Shepp_State_Space::Pruning_Counters counters = HCpmpm_Reeds_Shepp_State_Space::get_pruning_counters();
+  double nb_families = counters.nb_evaluated_families + counters.nb_pruned_families;
+  if (Instrumentation::enabled())
+  {
+    EXPECT_GT(counters.nb_pruned_families, 0u);
+    cout << "[----------] HCpmpm pruned families: " << counters.nb_pruned_families / nb_families << endl;
+  }
+  else
+    EXPECT_EQ(nb_families, 0);
+  cout << "[----------] HCpmpm exhaustive mean hcpmpm_reeds_shepp [s]: " << exhaustive_time.count() / SAMPLES
+       << ", pruned mean hcpmpm_reeds_shepp [s]: " << pruned_time.count() / SAMPLES << endl;
+}
+
+// high-precision reference of the Fresnel integrals: composite 10-point Gauss-Legendre quadrature in long double
+void fresnel_reference(double x, long double *c, long double *s)
+{
+  static const long double nodes[] = { 0.1488743389816312108848260011297200L, 0.4333953941292471907992659431657842L,
+                                       0.6794095682990244062343273651148736L, 0.8650633666889845107320966884234930L,
+                                       0.9739065285171717200779640120844521L };
+  static const long double weights[] = { 0.2955242247147528701738929946513383L, 0.2692667193099963550912269215694694L,
+                                         0.2190863625159820439955349342281632L, 0.1494513491505805931457763396576973L,
+                                         0.0666713443086881375935688098933342L };
+  long double ux = fabsl(x);
+  // the panels are refined with the frequency of the integrand
+  int nb_panels = max(1, static_cast<int>(ceill(16 * ux * (1 + ux))));
+  long double h = ux / nb_panels;
+  *c = 0;
+  *s = 0;
+  for (int i = 0; i < nb_panels; i++)
+  {
+    long double center = (i + 0.5L) * h;
+    for (int j = 0; j < 5; j++)
+    {
+      for (int sign = -1; sign <= 1; sign += 2)
+      {
+        long double u = center + sign * nodes[j] * h / 2;
+        long double phase = 1.57079632679489661923132169163975144L * u * u;
+        *c += weights[j] * h / 2 * cosl(phase);
+        *s += weights[j] * h / 2 * sinl(phase);
+      }
+    }
+  }
+  if (x < 0)
+  {
+    *c = -*c;
+    *s = -*s;
+  }
+}
+
+TEST(SteeringFunctions, fresnelAccuracy)
+{
+  double max_error_c = 0, max_error_s = 0;
+  for (double x = -8; x <= 8; x += 0.0041)
+  {
+    long double c_ref, s_ref;
+    fresnel_reference(x, &c_ref, &s_ref);
+    double c, s;
+    fresnel_cs(x, &c, &s);
+    max_error_c = max(max_error_c, static_cast<double>(fabsl(c - c_ref)));
+    max_error_s = max(max_error_s, static_cast<double>(fabsl(s - s_ref)));
+  }
+  EXPECT_LT(max_error_c, 1e-15);
+  EXPECT_LT(max_error_s, 1e-15);
+  // limits
+  double c, s;
+  fresnel_cs(1e5, &c, &s);
+  EXPECT_EQ(c, 0.5);
+  EXPECT_EQ(s, 0.5);
+
+  srand(seed);
+  vector<double> xs(SAMPLES);
+  for (auto &x : xs)
+    x = 4 * (static_cast<double>(rand()) / RAND_MAX) - 2;
+  double sum = 0;
+  auto clock_start = chrono::steady_clock::now();
+  for (const auto &x : xs)
+  {
+    fresnel_cs(x, &c, &s);
+    sum += c + s;
+  }
+  chrono::duration<double> fresnel_time = chrono::steady_clock::now() - clock_start;
+  EXPECT_TRUE(std::isfinite(sum));
+  cout << "[----------] Fresnel max. error C: " << max_error_c << ", S: " << max_error_s
+       << ", mean fresnel_cs [s]: " << fresnel_time.count() / SAMPLES << endl;
+}
+
+TEST(SteeringFunctions, fresnelBatch)
+{
+  srand(seed);
+  // not a multiple of the SIMD width, with values beyond the expansions and special values
+  vector<double> xs(SAMPLES + 3);
+  for (auto &x : xs)
+    x = 12 * (static_cast<double>(rand()) / RAND_MAX) - 6;
+  xs[0] = 0.0;
+  xs[1] = -0.0;
+  xs[2] = 4.0;
+  xs[3] = -4.0;
+  xs[4] = 1e5;
+  vector<double> c(xs.size()), s(xs.size());
+  fresnel_cs(xs.data(), c.data(), s.data(), xs.size());
+  int nb_mismatches = 0;
+  for (size_t i = 0; i < xs.size(); i++)
+  {
+    double c_i, s_i;
+    fresnel_cs(xs[i], &c_i, &s_i);
+    if (c_i != c[i] || s_i != s[i] || signbit(c_i) != signbit(c[i]))
+      nb_mismatches++;
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+
+  // samples along clothoids from the same initial configuration
+  vector<double> lengths(1000);
+  vector<double> x_f(lengths.size()), y_f(lengths.size()), theta_f(lengths.size()), kappa_f(lengths.size());
+  for (int i = 0; i < 100; i++)
+  {
+    State start = get_random_state();
+    double kappa_i = KAPPA * (rand() % 3 - 1);
+    double sigma = SIGMA * (rand() % 3 - 1);
+    bool forward = rand() % 2;
+    for (auto &length : lengths)
+      length = KAPPA / SIGMA * (static_cast<double>(rand()) / RAND_MAX);
+    end_of_clothoid(start.x, start.y, start.theta, kappa_i, sigma, forward, lengths.data(), lengths.size(),
+                    x_f.data(), y_f.data(), theta_f.data(), kappa_f.data());
+    for (size_t j = 0; j < lengths.size(); j++)
+    {
+      double x, y, theta, kappa;
+      end_of_clothoid(start.x, start.y, start.theta, kappa_i, sigma, forward, lengths[j], &x, &y, &theta, &kappa);
+      EXPECT_EQ(x, x_f[j]);
+      EXPECT_EQ(y, y_f[j]);
+      EXPECT_EQ(theta, theta_f[j]);
+      EXPECT_EQ(kappa, kappa_f[j]);
+    }
+  }
+
+  // timing on the range of the expansions
+  for (auto &x : xs)
+    x = 8 * (static_cast<double>(rand()) / RAND_MAX) - 4;
+  auto clock_start = chrono::steady_clock::now();
+  for (size_t i = 0; i < xs.size(); i++)
+    fresnel_cs(xs[i], &c[i], &s[i]);
+  chrono::duration<double> scalar_time = chrono::steady_clock::now() - clock_start;
+  clock_start = chrono::steady_clock::now();
+  fresnel_cs(xs.data(), c.data(), s.data(), xs.size());
+  chrono::duration<double> batch_time = chrono::steady_clock::now() - clock_start;
+  cout << "[----------] Fresnel mean scalar fresnel_cs [s]: " << scalar_time.count() / xs.size()
+       << ", batch fresnel_cs [s]: " << batch_time.count() / xs.size() << endl;
+}
+
+atomic<size_t> nb_allocations(0);
+
+void* operator new(size_t size)
+{
+  nb_allocations++;
+  void* p = malloc(size);
+  if (!p)
+    throw bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+TEST(SteeringFunctions, allocations)
+{
+  srand(0);
+  size_t distance_allocations = 0;
+  size_t controls_allocations = 0;
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    start.kappa = KAPPA * (rand() % 3 - 1);
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+
+    size_t n = nb_allocations;
+    hcpmpm_ss.get_distance(start, goal);
+    distance_allocations += nb_allocations - n;
+
+    n = nb_allocations;
+    hcpmpm_ss.get_controls(start, goal);
+    controls_allocations += nb_allocations - n;
+  }
+  cout << "[----------] HCpmpm allocations per call get_distance: " << distance_allocations / SAMPLES
+       << ", get_controls: " << controls_allocations / SAMPLES << endl;
+  EXPECT_EQ(distance_allocations, 0);
+  EXPECT_LE(controls_allocations, SAMPLES);
+}
+
+// compares the lazy range with the materialized path
+template <typename State_Space>
+void check_path_range(const State_Space& state_space, const State& start, const State& goal, int* nb_mismatches,
+                      size_t* iteration_allocations)
+{
+  vector<State> path = state_space.get_path(start, goal);
+  Path_Range range = state_space.get_path_range(start, goal);
+  ASSERT_EQ(range.size(), path.size());
+  vector<double> arc_lengths;
+  arc_lengths.reserve(path.size());
+  size_t n = nb_allocations;
+  size_t i = 0;
+  for (auto it = range.begin(); it != range.end(); ++it)
+  {
+    if (it->x != path[i].x || it->y != path[i].y || it->theta != path[i].theta || it->kappa != path[i].kappa ||
+        it->d != path[i].d)
+      (*nb_mismatches)++;
+    arc_lengths.push_back(it.arc_length());
+    i++;
+  }
+  *iteration_allocations += nb_allocations - n;
+  EXPECT_EQ(i, path.size());
+  EXPECT_NEAR(arc_lengths.back(), range.length(), EPS_DISTANCE);
+  // seeking returns the first state at the arc length
+  for (int j = 0; j < 10; j++)
+  {
+    double s = random(0.0, range.length());
+    auto it = range.seek(s);
+    ASSERT_TRUE(it != range.end());
+    EXPECT_GE(it.arc_length(), s);
+    EXPECT_TRUE(it.index() == 0 || arc_lengths[it.index() - 1] < s);
+    EXPECT_EQ(it->x, path[it.index()].x);
+    EXPECT_EQ(it->y, path[it.index()].y);
+  }
+  EXPECT_TRUE(range.seek(range.length() + 1.0) == range.end());
+}
+
+TEST(SteeringFunctions, pathRange)
+{
+  int nb_mismatches = 0;
+  size_t iteration_allocations = 0;
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    check_path_range(cc_dubins_forwards_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(cc_dubins_backwards_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(dubins_forwards_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(dubins_backwards_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(cc_rs_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(hc00_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(hc0pm_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(hcpm0_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(hcpmpm_ss, start, goal, &nb_mismatches, &iteration_allocations);
+    check_path_range(rs_ss, start, goal, &nb_mismatches, &iteration_allocations);
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  EXPECT_EQ(iteration_allocations, 0);
+
+  // early termination after the first tenth of the path
+  chrono::duration<double> path_time(0), range_time(0);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    auto clock_start = chrono::steady_clock::now();
+    vector<State> path = hcpmpm_ss.get_path(start, goal);
+    double x = 0;
+    for (size_t j = 0; j < path.size() / 10; j++)
+      x += path[j].x;
+    path_time += chrono::steady_clock::now() - clock_start;
+    clock_start = chrono::steady_clock::now();
+    Path_Range range = hcpmpm_ss.get_path_range(start, goal);
+    double x_range = 0;
+    size_t j = 0;
+    for (auto it = range.begin(); j < range.size() / 10; ++it, ++j)
+      x_range += it->x;
+    range_time += chrono::steady_clock::now() - clock_start;
+    EXPECT_EQ(x, x_range);
+  }
+  cout << "[----------] HCpmpm mean time to the first tenth of the path get_path [s]: "
+       << path_time.count() / (SAMPLES / 100) << ", get_path_range [s]: "
+       << range_time.count() / (SAMPLES / 100) << endl;
+}
+
+// compares state_at with the sampled states and the batch queries with the single queries
+template <typename State_Space>
+void check_state_at(const State_Space& state_space, const State& start, const State& goal, int* nb_mismatches,
+                    chrono::duration<double>* query_time)
+{
+  vector<Control> controls = state_space.get_controls(start, goal);
+  Path_Range range = state_space.get_path_range(start, controls);
+  for (auto it = range.begin(); it != range.end(); ++it)
+  {
+    State state = range.state_at(it.arc_length());
+    EXPECT_NEAR(state.x, it->x, EPS_DISTANCE);
+    EXPECT_NEAR(state.y, it->y, EPS_DISTANCE);
+    EXPECT_LT(fabs(pify(state.theta - it->theta)), EPS_YAW);
+  }
+  const int nb_queries = 50;
+  double s[nb_queries];
+  State states[nb_queries];
+  for (int i = 0; i < nb_queries; i++)
+    s[i] = random(-0.1, range.length() + 0.1);
+  sort(s, s + nb_queries);
+  auto clock_start = chrono::steady_clock::now();
+  state_space.states_at(start, controls, s, nb_queries, states);
+  *query_time += chrono::steady_clock::now() - clock_start;
+  for (int i = 0; i < nb_queries; i++)
+  {
+    State state = state_space.state_at(start, controls, s[i]);
+    if (state.x != states[i].x || state.y != states[i].y || state.theta != states[i].theta ||
+        state.kappa != states[i].kappa || state.d != states[i].d)
+      (*nb_mismatches)++;
+  }
+}
+
+TEST(SteeringFunctions, stateAt)
+{
+  int nb_mismatches = 0;
+  chrono::duration<double> query_time(0);
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    check_state_at(cc_dubins_forwards_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(cc_dubins_backwards_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(dubins_forwards_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(dubins_backwards_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(cc_rs_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(hc00_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(hc0pm_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(hcpm0_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(hcpmpm_ss, start, goal, &nb_mismatches, &query_time);
+    check_state_at(rs_ss, start, goal, &nb_mismatches, &query_time);
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  cout << "[----------] Mean time of 50 sorted state_at queries [s]: " << query_time.count() / (SAMPLES / 10) << endl;
+}
+
+// compares the structure of arrays with the materialized path
+template <typename State_Space>
+void check_sample_path(const State_Space& state_space, const State& start, const State& goal, vector<double>* buffers,
+                       int* nb_mismatches, size_t* sampling_allocations)
+{
+  vector<State> path = state_space.get_path(start, goal);
+  vector<Control> controls = state_space.get_controls(start, goal);
+  size_t size = state_space.sample_path(start, controls, nullptr, nullptr, nullptr, nullptr, nullptr, 0);
+  ASSERT_EQ(size, path.size());
+  if (buffers[0].size() < size)
+    for (int i = 0; i < 5; i++)
+      buffers[i].resize(2 * size);
+  size_t n = nb_allocations;
+  size = state_space.sample_path(start, controls, buffers[0].data(), buffers[1].data(), buffers[2].data(),
+                                 buffers[3].data(), buffers[4].data(), buffers[0].size());
+  *sampling_allocations += nb_allocations - n;
+  for (size_t i = 0; i < size; i++)
+    if (buffers[0][i] != path[i].x || buffers[1][i] != path[i].y || buffers[2][i] != path[i].theta ||
+        buffers[3][i] != path[i].kappa || buffers[4][i] != path[i].d)
+      (*nb_mismatches)++;
+  // truncated output is a prefix of the path
+  size_t capacity = size / 2;
+  fill(buffers[0].begin(), buffers[0].end(), -1.0);
+  EXPECT_EQ(state_space.sample_path(start, controls, buffers[0].data(), nullptr, nullptr, nullptr, nullptr, capacity),
+            path.size());
+  for (size_t i = 0; i < capacity; i++)
+    if (buffers[0][i] != path[i].x)
+      (*nb_mismatches)++;
+  EXPECT_EQ(buffers[0][capacity], -1.0);
+}
+
+TEST(SteeringFunctions, samplePath)
+{
+  vector<double> buffers[5];
+  int nb_mismatches = 0;
+  size_t sampling_allocations = 0;
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    check_sample_path(cc_dubins_forwards_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(cc_dubins_backwards_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(dubins_forwards_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(dubins_backwards_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(cc_rs_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(hc00_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(hc0pm_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(hcpm0_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(hcpmpm_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+    check_sample_path(rs_ss, start, goal, buffers, &nb_mismatches, &sampling_allocations);
+  }
+  EXPECT_EQ(nb_mismatches, 0);
+  EXPECT_EQ(sampling_allocations, 0);
+}
+
+// returns the distance of a state to the polyline through the path
+double distance_to_polyline(const State& state, const vector<State>& path)
+{
+  double distance = numeric_limits<double>::max();
+  for (size_t i = 0; i + 1 < path.size(); i++)
+  {
+    double dx = path[i + 1].x - path[i].x, dy = path[i + 1].y - path[i].y;
+    double chord = dx * dx + dy * dy;
+    double t = chord > 0.0 ? ((state.x - path[i].x) * dx + (state.y - path[i].y) * dy) / chord : 0.0;
+    t = max(0.0, min(1.0, t));
+    distance = min(distance, sqrt(pow(state.x - path[i].x - t * dx, 2) + pow(state.y - path[i].y - t * dy, 2)));
+  }
+  return distance;
+}
+
+// checks the deviation of the sampled path from the adaptive one
+template <typename State_Space>
+void check_adaptive_path(const State_Space& state_space, const State& start, const State& goal, double tolerance,
+                         double* max_deviation, size_t* nb_states, size_t* nb_adaptive_states)
+{
+  vector<State> path = state_space.get_path(start, goal);
+  vector<State> adaptive_path = state_space.get_path_adaptive(start, goal, tolerance);
+  ASSERT_FALSE(adaptive_path.empty());
+  EXPECT_EQ(adaptive_path.front().x, path.front().x);
+  EXPECT_EQ(adaptive_path.front().y, path.front().y);
+  EXPECT_NEAR(adaptive_path.back().x, path.back().x, EPS_DISTANCE);
+  EXPECT_NEAR(adaptive_path.back().y, path.back().y, EPS_DISTANCE);
+  for (const auto& state : path)
+    *max_deviation = max(*max_deviation, distance_to_polyline(state, adaptive_path));
+  *nb_states += path.size();
+  *nb_adaptive_states += adaptive_path.size();
+}
+
+TEST(SteeringFunctions, adaptivePath)
+{
+  double tolerance = 0.01;
+  double max_deviation = 0.0;
+  size_t nb_states = 0, nb_adaptive_states = 0;
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    check_adaptive_path(cc_dubins_forwards_ss, start, goal, tolerance, &max_deviation, &nb_states,
+                        &nb_adaptive_states);
+    check_adaptive_path(cc_dubins_backwards_ss, start, goal, tolerance, &max_deviation, &nb_states,
+                        &nb_adaptive_states);
+    check_adaptive_path(dubins_forwards_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(dubins_backwards_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(cc_rs_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(hc00_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(hc0pm_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(hcpm0_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(hcpmpm_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+    check_adaptive_path(rs_ss, start, goal, tolerance, &max_deviation, &nb_states, &nb_adaptive_states);
+  }
+  EXPECT_LE(max_deviation, tolerance + EPS_DISTANCE);
+  EXPECT_LT(nb_adaptive_states, nb_states);
+  cout << "[----------] Adaptive sampling with tolerance " << tolerance << " [m]: " << nb_adaptive_states
+       << " instead of " << nb_states << " states, max. deviation [m]: " << max_deviation << endl;
+}
+
+TEST(SteeringFunctions, adaptivePathInvalidTolerance)
+{
+  srand(seed);
+  State start = get_random_state();
+  State goal = get_random_state();
+  vector<Control> controls = cc_dubins_forwards_ss.get_controls(start, goal);
+  const double tolerances[] = { 0.0, -0.01, numeric_limits<double>::infinity(),
+                                 numeric_limits<double>::quiet_NaN() };
+  for (double tolerance : tolerances)
+  {
+    EXPECT_TRUE(hcpmpm_ss.get_path_adaptive(start, goal, tolerance).empty());
+    EXPECT_TRUE(rs_ss.get_path_adaptive(start, goal, tolerance).empty());
+    EXPECT_TRUE(dubins_forwards_ss.get_path_adaptive(start, goal, tolerance).empty());
+    EXPECT_TRUE(cc_dubins_forwards_ss.integrate_adaptive(start, controls, tolerance).empty());
+  }
+  EXPECT_FALSE(hcpmpm_ss.get_path_adaptive(start, goal, 1e-3).empty());
+}
+
+TEST(SteeringFunctions, instrumentation)
+{
+  Instrumentation::reset();
+  if (!Instrumentation::enabled())
+  {
+    EXPECT_TRUE(Instrumentation::snapshot().empty());
+    return;
+  }
+  srand(seed);
+  vector<State> starts, goals;
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    starts.push_back(get_random_state());
+    goals.push_back(get_random_state());
+  }
+  auto queries = [&]() {
+    for (size_t i = 0; i < starts.size(); i++)
+    {
+      cc_dubins_forwards_ss.get_distance(starts[i], goals[i]);
+      cc_rs_ss.get_distance(starts[i], goals[i]);
+      hc00_ss.get_distance(starts[i], goals[i]);
+      hc0pm_ss.get_distance(starts[i], goals[i]);
+      hcpm0_ss.get_distance(starts[i], goals[i]);
+      hcpmpm_ss.get_distance(starts[i], goals[i]);
+      rs_ss.get_distance(starts[i], goals[i]);
+    }
+  };
+  // the snapshot aggregates the calling thread, a finished thread and the running worker threads of a distance
+  // matrix (the 2 x 2 Reeds-Shepp matrix of single-state tiles is distributed over the calling and a worker thread)
+  queries();
+  thread finished_thread(queries);
+  finished_thread.join();
+  vector<double> distances(4);
+  Distance_Matrix distance_matrix(2, 1);
+  distance_matrix.compute(rs_ss, starts.data(), 2, goals.data(), 2, distances.data());
+  // each query is won by exactly one family
+  map<string, unsigned long long> nb_wins;
+  for (const auto& record : Instrumentation::snapshot())
+  {
+    EXPECT_LE(record.statistics.nb_hits, record.statistics.nb_evaluations);
+    EXPECT_GE(record.statistics.time, 0.0);
+    nb_wins[record.state_space] += record.statistics.nb_wins;
+  }
+  EXPECT_EQ(nb_wins.size(), static_cast<size_t>(nb_instrumented_state_spaces));
+  for (const auto& wins : nb_wins)
+    EXPECT_EQ(wins.second, static_cast<unsigned long long>(2 * starts.size() + (wins.first == "Reeds_Shepp" ? 4 : 0)))
+        << wins.first;
+  fstream f(string(STEERING_FUNCTIONS_TEST_DIR) + "/family_stats.csv", ios::out);
+  Instrumentation::dump(f);
+  Instrumentation::reset();
+  for (const auto& record : Instrumentation::snapshot())
+  {
+    EXPECT_EQ(record.statistics.nb_evaluations, 0u);
+    EXPECT_EQ(record.statistics.nb_wins, 0u);
+  }
+}
+
+// checks the heuristic table against get_distance for random start states and relative goal poses
+template <typename State_Space>
+void check_heuristic_table(const State_Space& state_space, const string& id)
+{
+  Heuristic_Table::Parameters parameters = { 4.0, 0.25, 32, Heuristic_Table::HEURISTIC_INTERPOLATED, 1 };
+  Heuristic_Table interpolated, sampled_minimum;
+  auto clock_start = chrono::steady_clock::now();
+  interpolated.build(state_space, parameters);
+  chrono::duration<double> build_time = chrono::steady_clock::now() - clock_start;
+  parameters.mode = Heuristic_Table::HEURISTIC_SAMPLED_MINIMUM;
+  parameters.nb_subsamples = 2;
+  sampled_minimum.build(state_space, parameters);
+
+  double fine_step = parameters.resolution / parameters.nb_subsamples;
+  double fine_theta_step = 2 * PI / (parameters.nb_theta * parameters.nb_subsamples);
+  double error = 0.0, max_error = 0.0;
+  srand(seed);
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    // the goal is placed on a sample of the fine grid relative to the random start state
+    State start = get_random_state();
+    double dx = -parameters.extent + fine_step * (rand() % 33);
+    double dy = -parameters.extent + fine_step * (rand() % 33);
+    double dtheta = fine_theta_step * (rand() % 64);
+    State goal = get_relative_state(start, dx, dy, dtheta);
+    double distance = state_space.get_distance(start, goal);
+    EXPECT_LE(sampled_minimum.get_distance(start, goal), distance + EPS_DISTANCE);
+    double deviation = fabs(interpolated.get_distance(start, goal) - distance);
+    error += deviation;
+    max_error = max(max_error, deviation);
+    // at the vertices, the interpolation returns the sampled path lengths
+    State origin;
+    int a = rand() % 33, b = rand() % 33, c = rand() % parameters.nb_theta;
+    double vertex_dx = -parameters.extent + parameters.resolution * a;
+    double vertex_dy = -parameters.extent + parameters.resolution * b;
+    double vertex_dtheta = 2 * PI * c / parameters.nb_theta;
+    double vertex_distance = state_space.get_distance(origin, get_relative_state(origin, vertex_dx, vertex_dy,
+                                                                                 vertex_dtheta));
+    EXPECT_NEAR(interpolated.get_distance(vertex_dx, vertex_dy, vertex_dtheta), vertex_distance,
+                1e-6 * (1.0 + vertex_distance));
+    // outside of the table, the Euclidean distance is a lower bound
+    State far_goal = get_relative_state(start, dx + 3 * parameters.extent, dy, dtheta);
+    EXPECT_LE(interpolated.get_distance(start, far_goal), state_space.get_distance(start, far_goal) + EPS_DISTANCE);
+  }
+  // poses that are not finite are answered with the Euclidean distance
+  EXPECT_EQ(interpolated.get_distance(1.0, 1.0, numeric_limits<double>::quiet_NaN()), sqrt(2.0));
+  EXPECT_EQ(sampled_minimum.get_distance(1.0, 1.0, numeric_limits<double>::infinity()), sqrt(2.0));
+  EXPECT_TRUE(std::isnan(interpolated.get_distance(numeric_limits<double>::quiet_NaN(), 0.0, 0.0)));
+  cout << "[----------] " << id << " heuristic table build [s]: " << build_time.count()
+       << ", mean interpolation error [m]: " << error / (SAMPLES / 100) << ", max. interpolation error [m]: "
+       << max_error << ", max. range within a cell [m]: " << interpolated.get_max_error()
+       << ", max. sampled minimum error [m]: " << sampled_minimum.get_max_error() << endl;
+}
+
+TEST(SteeringFunctions, heuristicTable)
+{
+  check_heuristic_table(cc_dubins_forwards_ss, "CC_Dubins");
+  check_heuristic_table(dubins_forwards_ss, "Dubins");
+  check_heuristic_table(hc00_ss, "HC00");
+  check_heuristic_table(rs_ss, "RS");
+}
+
+// returns a unique file name in $TMPDIR (or /tmp), the file is created empty
+string get_temporary_filename(const string& prefix)
+{
+  const char* directory = getenv("TMPDIR");
+  string pattern = string(directory && *directory ? directory : "/tmp") + "/" + prefix + ".XXXXXX";
+  vector<char> filename(pattern.begin(), pattern.end());
+  filename.push_back('\0');
+  int fd = mkstemp(filename.data());
+  if (fd < 0)
+    return string();
+  close(fd);
+  return string(filename.data());
+}
+
+// removes a file when it goes out of scope, also if an assertion fails
+struct File_Remover
+{
+  string filename;
+  ~File_Remover()
+  {
+    if (!filename.empty())
+      remove(filename.c_str());
+  }
+};
+
+TEST(SteeringFunctions, heuristicTableFile)
+{
+  Heuristic_Table::Parameters parameters = { 4.0, 0.25, 32, Heuristic_Table::HEURISTIC_SAMPLED_MINIMUM, 2 };
+  Heuristic_Table::Description description = { "CC_Reeds_Shepp", KAPPA, SIGMA };
+  Heuristic_Table table, mapped_table;
+  auto clock_start = chrono::steady_clock::now();
+  table.build(cc_rs_ss, parameters);
+  chrono::duration<double> build_time = chrono::steady_clock::now() - clock_start;
+  string filename = get_temporary_filename("heuristic_table");
+  File_Remover remover = { filename };
+  ASSERT_FALSE(filename.empty());
+  ASSERT_TRUE(table.save(filename, description));
+  clock_start = chrono::steady_clock::now();
+  ASSERT_TRUE(mapped_table.load(filename, description));
+  chrono::duration<double> load_time = chrono::steady_clock::now() - clock_start;
+
+  // the mapped table is identical to the built one and outlives its copies
+  EXPECT_EQ(mapped_table.get_max_error(), table.get_max_error());
+  Heuristic_Table copied_table = mapped_table;
+  mapped_table = Heuristic_Table();
+  srand(seed);
+  double extent = parameters.extent;
+  for (int i = 0; i < SAMPLES / 100; i++)
+  {
+    State start = get_random_state();
+    State goal = get_relative_state(start, random(-extent, extent), random(-extent, extent), random(-PI, PI));
+    EXPECT_EQ(copied_table.get_distance(start, goal), table.get_distance(start, goal));
+  }
+
+  // the files of other state spaces, other versions and corrupted files are rejected
+  Heuristic_Table rejected_table;
+  Heuristic_Table::Description other_description = { "CC_Reeds_Shepp", KAPPA, 2 * SIGMA };
+  EXPECT_FALSE(rejected_table.load(filename, other_description));
+  other_description = { "HC00_Reeds_Shepp", KAPPA, SIGMA };
+  EXPECT_FALSE(rejected_table.load(filename, other_description));
+  EXPECT_FALSE(rejected_table.load(filename + ".missing", description));
+  fstream f(filename, ios::in | ios::out | ios::binary);
+  f.seekp(200);
+  f.put(0x7f);
+  f.close();
+  EXPECT_FALSE(rejected_table.load(filename, description));
+  EXPECT_TRUE(rejected_table.load(filename, description, false));
+  f.open(filename, ios::in | ios::out | ios::binary);
+  f.seekp(8);
+  f.put(2);
+  f.close();
+  EXPECT_FALSE(rejected_table.load(filename, description, false));
+
+  // concurrent writers of the same file do not share a temporary file, the result is a complete table
+  vector<thread> writers;
+  atomic<int> nb_failures(0);
+  for (int t = 0; t < 4; t++)
+    writers.push_back(thread([&]() {
+      for (int n = 0; n < 5; n++)
+        if (!table.save(filename, description))
+          nb_failures++;
+    }));
+  for (auto& writer : writers)
+    writer.join();
+  EXPECT_EQ(nb_failures, 0);
+  EXPECT_TRUE(rejected_table.load(filename, description));
+
+  // a header with an invalid grid is rejected even without the checksum
+  f.open(filename, ios::in | ios::out | ios::binary);
+  f.seekp(104);  // resolution
+  for (int i = 0; i < 8; i++)
+    f.put(0);
+  f.close();
+  EXPECT_FALSE(rejected_table.load(filename, description, false));
+  cout << "[----------] CC_RS heuristic table build [s]: " << build_time.count()
+       << ", load [s]: " << load_time.count() << endl;
+}
+
+// returns whether the controls are bitwise identical
+bool controls_equal(const vector<Control>& controls1, const vector<Control>& controls2)
+{
+  if (controls1.size() != controls2.size())
+    return false;
+  for (size_t i = 0; i < controls1.size(); i++)
+    if (controls1[i].delta_s != controls2[i].delta_s || controls1[i].kappa != controls2[i].kappa ||
+        controls1[i].sigma != controls2[i].sigma)
+      return false;
+  return true;
+}
+
+TEST(SteeringFunctions, controlsCache)
+{
+  const int nb_queries = SAMPLES / 100;
+  vector<State> starts, goals;
+  srand(seed);
+  for (int i = 0; i < nb_queries; i++)
+  {
+    State start = get_random_state();
+    State goal = get_random_state();
+    start.kappa = KAPPA * (rand() % 3 - 1);
+    goal.kappa = KAPPA * (rand() % 3 - 1);
+    starts.push_back(start);
+    goals.push_back(goal);
+  }
+
+  // repeated queries are answered from the cache with identical controls, also from several threads
+  vector<vector<Control>> expected_controls;
+  for (int i = 0; i < nb_queries; i++)
+    expected_controls.push_back(hcpmpm_ss.get_controls(starts[i], goals[i]));
+  Cached_State_Space<HCpmpm_Reeds_Shepp_State_Space> cached_ss(hcpmpm_ss, 4 * nb_queries);
+  auto clock_start = chrono::steady_clock::now();
+  for (int i = 0; i < nb_queries; i++)
+    EXPECT_TRUE(controls_equal(cached_ss.get_controls(starts[i], goals[i]), expected_controls[i]));
+  chrono::duration<double> miss_time = chrono::steady_clock::now() - clock_start;
+  vector<thread> threads;
+  atomic<int> nb_mismatches(0);
+  for (int t = 0; t < 4; t++)
+    threads.push_back(thread([&]() {
+      for (int i = 0; i < nb_queries; i++)
+        if (!controls_equal(cached_ss.get_controls(starts[i], goals[i]), expected_controls[i]))
+          nb_mismatches++;
+    }));
+  for (auto& t : threads)
+    t.join();
+  EXPECT_EQ(nb_mismatches, 0);
+  clock_start = chrono::steady_clock::now();
+  for (int i = 0; i < nb_queries; i++)
+    cached_ss.get_distance(starts[i], goals[i]);
+  chrono::duration<double> hit_time = chrono::steady_clock::now() - clock_start;
+  Controls_Cache::Statistics statistics = cached_ss.get_cache().get_statistics();
+  EXPECT_EQ(statistics.nb_misses, static_cast<unsigned long long>(nb_queries));
+  EXPECT_EQ(statistics.nb_hits, static_cast<unsigned long long>(5 * nb_queries));
+  EXPECT_EQ(statistics.size, static_cast<size_t>(nb_queries));
+
+  // the least recently used entries are evicted
+  Cached_State_Space<HCpmpm_Reeds_Shepp_State_Space> small_cached_ss(hcpmpm_ss, 64, 4);
+  for (int i = 0; i < nb_queries; i++)
+    small_cached_ss.get_controls(starts[i], goals[i]);
+  statistics = small_cached_ss.get_cache().get_statistics();
+  EXPECT_EQ(statistics.size, 64u);
+  EXPECT_EQ(statistics.nb_evictions, static_cast<unsigned long long>(nb_queries - 64));
+  small_cached_ss.get_cache().clear();
+  EXPECT_EQ(small_cached_ss.get_cache().get_statistics().size, 0u);
+
+  // with quantization, the queries that differ by a rigid transformation share an entry
+  Cached_State_Space<HCpmpm_Reeds_Shepp_State_Space> quantized_ss(hcpmpm_ss, 4 * nb_queries, 16, 1e-6);
+  for (int i = 0; i < nb_queries; i++)
+  {
+    State transform = get_random_state();
+    double c = cos(transform.theta), s = sin(transform.theta);
+    State start = starts[i], goal = goals[i];
+    start.x = transform.x + c * starts[i].x - s * starts[i].y;
+    start.y = transform.y + s * starts[i].x + c * starts[i].y;
+    start.theta = starts[i].theta + transform.theta;
+    goal.x = transform.x + c * goals[i].x - s * goals[i].y;
+    goal.y = transform.y + s * goals[i].x + c * goals[i].y;
+    goal.theta = goals[i].theta + transform.theta;
+    vector<Control> controls = quantized_ss.get_controls(starts[i], goals[i]);
+    EXPECT_TRUE(controls_equal(quantized_ss.get_controls(start, goal), controls));
+  }
+  statistics = quantized_ss.get_cache().get_statistics();
+  EXPECT_GE(statistics.nb_hits, static_cast<unsigned long long>(0.99 * nb_queries));
+  cout << "[----------] HCpmpm mean get_controls on a cache miss [s]: " << miss_time.count() / nb_queries
+       << ", mean get_distance on a cache hit [s]: " << hit_time.count() / nb_queries
+       << ", transformed queries that hit: " << statistics.nb_hits << "/" << nb_queries << endl;
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);